@@ -47,8 +47,8 @@ public: any_t() noexcept {};
 
     template< class T >
     void set( const T& f ) noexcept { 
-        any_sz  = new uint(sizeof(T));
-        any_ptr = new any_impl<T>(f); 
+        any_sz  = ptr_t<uint>::make( sizeof(T) );
+        any_ptr = ptr_t<any_impl<T>>::make( f ); 
     }
 
     template< class T >
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_ARENA
+#define NODEPP_ARENA
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class arena_t; namespace _arena_ {
+
+    struct CHUNK { CHUNK* next; ulong size; };
+
+    ulong const ALIGN = sizeof(void*) * 2;
+    ulong const HEAD  = ( sizeof(CHUNK) + ALIGN - 1 ) / ALIGN * ALIGN;
+
+    thread_local arena_t* act = nullptr; // arena taking allocations
+
+    /* suspends the active arena while it lives; the event loop, timers and
+       listeners use it so what they register lands on the global heap and
+       survives the arena that was active when it was registered */
+
+    class heap_t { arena_t* prev;
+    public:
+        heap_t() noexcept : prev( act ) { act = nullptr; }
+       ~heap_t() noexcept { act = prev; }
+        bool paused() const noexcept { return prev != nullptr; }
+    };
+
+    template< class T, class... V >
+    T make( const V&... args ){ heap_t heap; return T( args... ); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class arena_t {
+protected:
+
+    /* a bump allocator: memory comes from geometrically grown chunks and
+       is only given back all at once, by reset() or the destructor. It is
+       not a handle, so it can't be copied, and anything allocated while it
+       is active must be dropped or promoted before it goes away; that
+       includes user objects still waiting on the loop, like a promise_t
+       or ws_t built inside the scope */
+
+    _arena_::CHUNK* head = nullptr;
+    char* pos = nullptr; char* end = nullptr;
+    ulong used = 0, next = ARENA_CHUNK;
+
+    arena_t* back = nullptr;
+
+    arena_t( const arena_t& ) = delete;
+    arena_t& operator=( const arena_t& ) = delete;
+
+    void grow( ulong size ) noexcept {
+        ulong len = size + _arena_::HEAD > next ? size + _arena_::HEAD : next;
+        auto  chk = (_arena_::CHUNK*) ::operator new( len );
+        chk->next = head; chk->size = len; head = chk; next = len * 2;
+        pos = (char*) chk + _arena_::HEAD; end = (char*) chk + len;
+    }
+
+    static void drain( _arena_::CHUNK* x ) noexcept {
+        while( x != nullptr ){ auto y = x->next; ::operator delete( (void*) x ); x = y; }
+    }
+
+public:
+
+    arena_t() noexcept {}
+
+    arena_t( ulong size ) noexcept { next = size; }
+
+    virtual ~arena_t() noexcept {
+        if( _arena_::act == this ){ _arena_::act = back; } drain( head );
+    }
+
+    /*─······································································─*/
+
+    void* alloc( ulong size ) noexcept {
+        size = ( size + _arena_::ALIGN - 1 ) / _arena_::ALIGN * _arena_::ALIGN;
+        if( pos == nullptr || (ulong)( end - pos ) < size ){ grow( size ); }
+        auto out = pos; pos += size; used += size; return out;
+    }
+
+    /*─······································································─*/
+
+    void reset() noexcept { if( head == nullptr ){ return; }
+        drain( head->next ); head->next = nullptr; used = 0;
+        pos = (char*) head + _arena_::HEAD; end = (char*) head + head->size;
+    }
+
+    ulong size() const noexcept { return used; }
+
+    /*─······································································─*/
+
+    void enter() noexcept { back = _arena_::act; _arena_::act = this; }
+
+    void leave() noexcept { if( _arena_::act == this ){ _arena_::act = back; } back = nullptr; }
+
+    class scope_t {
+    public: arena_t& out;
+        scope_t( arena_t& arena ) noexcept : out( arena ) { out.enter(); }
+       ~scope_t() noexcept { out.leave(); }
+    };
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _arena_ {
+
+    inline void* alloc( ulong size, bool& arn ) noexcept {
+        if( act == nullptr ){ arn = 0; return ::operator new( size ); }
+        arn = 1; return act->alloc( size );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace arena {
+
+    /* runs cb with no arena active, so whatever it allocates lands on the
+       global heap and may outlive the arena */
+
+    template< class F >
+    void heap( F cb ) { _arena_::heap_t guard; cb(); }
+
+    template< class T >
+    T promote( const T& value ) { T out; heap([&](){ out = value.copy(); }); return out; }
+
+    inline arena_t* active() noexcept { return _arena_::act; }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
@@ -18,7 +18,20 @@ namespace nodepp { template< class T >
 class array_t {    
 protected: 
 
-    ptr_t<T> buffer;
+    ptr_t<T> buffer; ulong length = 0;
+
+    void grow( ulong n ) noexcept {
+        if( buffer.count() == 1 && n <= capacity() ){ return; }
+        auto n_buffer = ptr_t<T>( n > capacity() ? max( n, capacity() * 2 ) : capacity() );
+        auto a = &n_buffer; auto b = &buffer; if( buffer.count() == 1 )
+             { for( ulong x=0; x<length; x++ ){ a[x] = type::move( b[x] ); } }
+        else { for( ulong x=0; x<length; x++ ){ a[x] = b[x]; } } buffer = n_buffer;
+    }
+
+    void expand( ulong index, ulong N ) noexcept {
+        grow( length + N ); ulong x = length; length += N; auto a = &buffer;
+        while( x-->index ){ a[x+N] = type::move( a[x] ); }
+    }
 
     ptr_t<ulong> get_slice_range( long x, long y ) const noexcept {
         
@@ -50,29 +63,29 @@ protected:
 
 public: array_t() noexcept {};
 
-    array_t( const ptr_t<T>& argc ) noexcept { buffer = argc; }
+    array_t( const ptr_t<T>& argc ) noexcept { buffer = argc; length = buffer.size(); }
 
     array_t( const ulong& n, const T& c ) noexcept {
-        if( n == 0 ){ return; } buffer = ptr_t<T>( n, c );
+        if( n == 0 ){ return; } buffer = ptr_t<T>( n, c ); length = n;
     }
 
     array_t( T* value, const ulong& n=0 ) noexcept { 
         if( value == nullptr || n == 0 ){ return; } 
-        buffer = ptr_t<T>( value, n );
+        buffer = ptr_t<T>( value, n ); length = n;
     }
     
     /*─······································································─*/
 
     template< class V, ulong N >
     array_t& operator=( const V (&value) [N] ) noexcept {
-        ulong s = 0; buffer = ptr_t<T>( N ); 
+        ulong s = 0; buffer = ptr_t<T>( N ); length = N;
         for( auto x=begin(); x!=end(); x++ )
            { (*x) = (T)value[s]; s++; } return *this;
     }
 
     template < class V, ulong N > 
     array_t( const V (&value)[N] ) noexcept { 
-        ulong s = 0; buffer = ptr_t<T>( N ); 
+        ulong s = 0; buffer = ptr_t<T>( N ); length = N;
         for( auto x=begin(); x!=end(); x++ )
            { (*x) = (T)value[s]; s++; } 
     }
@@ -84,10 +97,21 @@ public: array_t() noexcept {};
     
     /*─······································································─*/
 
-    ulong first() const noexcept { return 0; }
-    bool  empty() const noexcept { return buffer.empty(); }
-    ulong  size() const noexcept { return empty() ? 0 : buffer.size() - 0; }
-    ulong  last() const noexcept { return empty() ? 0 : buffer.size() - 1; }
+    ulong    first() const noexcept { return 0; }
+    bool     empty() const noexcept { return length == 0; }
+    ulong     size() const noexcept { return length; }
+    ulong     last() const noexcept { return empty() ? 0 : length - 1; }
+    ulong capacity() const noexcept { return buffer.size(); }
+    
+    /*─······································································─*/
+
+    void reserve( ulong n ) noexcept { if( n > capacity() ){ grow( n ); } }
+
+    void shrink_to_fit() noexcept {
+        if( capacity() == length ){ return; } if( length == 0 ){ buffer.reset(); return; }
+        auto n_buffer = ptr_t<T>( length ); for( ulong x=0; x<length; x++ )
+           { n_buffer[x] = buffer[x]; } buffer = n_buffer;
+    }
     
     /*─······································································─*/
 
@@ -141,7 +165,7 @@ public: array_t() noexcept {};
     ptr_t<int> find( const array_t& data, ulong offset=0 ) const noexcept {
         if ( data.empty() ){ return nullptr; }
         ulong x=0; int n=0; ptr_t<int> pos ({ 0, 0 });
-        for( ulong i=offset; i<buffer.size(); i++ ){ 
+        for( ulong i=offset; i<size(); i++ ){ 
             if ( buffer[i] == data[x] ){
                 pos[n]=i; x++; n=1;
             } elif ( x==data.size() ){ 
@@ -180,14 +204,17 @@ public: array_t() noexcept {};
         for( auto& x : *this ){ if(func(x)) x=targ; } return (*this); 
     }
 
-    array_t copy() const noexcept { return buffer.copy(); }
+    array_t copy() const noexcept { 
+        if( empty() ){ return nullptr; } auto n_buffer = ptr_t<T>( length );
+        for( ulong x=0; x<length; x++ ){ n_buffer[x] = buffer[x]; } return n_buffer;
+    }
     
     /*─······································································─*/
 
     void fill( const char& argc ) const noexcept { buffer.fill(argc); }
 
     template< class... V >
-    void resize( const V&... args ) noexcept { buffer.resize(args...); }
+    void resize( const V&... args ) noexcept { buffer.resize(args...); length = buffer.size(); }
     
     /*─······································································─*/
 
@@ -213,99 +240,66 @@ public: array_t() noexcept {};
      
     /*─······································································─*/
 
-    void clear() noexcept { buffer.reset(); }
-    void erase() noexcept { buffer.reset(); }
-    void  free() noexcept { buffer.reset(); }
+    void clear() noexcept { buffer.reset(); length = 0; }
+    void erase() noexcept { buffer.reset(); length = 0; }
+    void  free() noexcept { buffer.reset(); length = 0; }
     
     /*─······································································─*/
 
     void insert( ulong index, const T& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = ptr_t<T> ( 1 ); buffer[0] = value; } 
-        else { ulong n=size() + 1; auto n_buffer = ptr_t<T>(n); 
-            for( ulong x=0,i=0; x<n; x++ ){ 
-                if( x == index ){ n_buffer[x] = value; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+        insert( index, 1UL, value );
     }
 
     void insert( ulong index, ulong N, T* value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = ptr_t<T> ( value, N ); } 
-        else { ulong n=size() + N; auto n_buffer = ptr_t<T>(n); 
-            for( ulong x=0,i=0,p=0; x<n; x++ ){ 
-                if( x>=index && x<index+N ){ n_buffer[x] = value[p++]; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N == 0 || value == nullptr ){ return; }
+        if( value >= &buffer && value < &buffer + capacity() )
+          { auto n_buffer = ptr_t<T>( N ); for( ulong x=0; x<N; x++ ){ n_buffer[x] = value[x]; }
+            insert( index, array_t( n_buffer ) ); return; }
+        expand( index, N ); for( ulong x=0; x<N; x++ )
+          { buffer[index+x] = value[x]; }
     }
 
     void insert( ulong index, ulong N, const T& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = ptr_t<T> ( N, value ); } 
-        else { ulong n=size() + N; auto n_buffer = ptr_t<T>(n); 
-            for( ulong x=0,i=0; x<n; x++ ){ 
-                if( x>=index && x<index+N ){ n_buffer[x] = value; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N == 0 ){ return; }
+        T item = value; expand( index, N ); 
+        for( ulong x=0; x<N; x++ ){ buffer[index+x] = item; }
     }
 
     void insert( ulong index, const array_t& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = ptr_t<T> ( value.size() ); 
-            for( ulong i=0; i<value.size(); i++ ){ buffer[i] = value[i]; }
-        } else { ulong n=size() + value.size(); auto n_buffer = ptr_t<T>(n); 
-            for( ulong x=0,i=0,p=0; x<n; x++ ){ 
-                if( x>=index && x<index+value.size() ){ n_buffer[x] = value[p++]; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+        if( value.empty() ){ return; } if( value.buffer.get() == buffer.get() )
+          { insert( index, value.copy() ); return; }
+	    index = clamp( index, 0UL, size() ); expand( index, value.size() ); 
+        for( ulong x=0; x<value.size(); x++ ){ buffer[index+x] = value[x]; }
     }
 
     template< class V, ulong N >
     void insert( ulong index, const V (&value)[N] ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = ptr_t<T> ( N ); 
-            for( ulong i=0; i<N; i++ ){ buffer[i] = value[i]; }
-        } else { ulong n=size() + N; auto n_buffer = ptr_t<T>(n); 
-            for( ulong x=0,i=0,p=0; x<n; x++ ){ 
-             if( x>=index && x<index+N ){ n_buffer[x] = value[p++]; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); expand( index, N );
+        for( ulong x=0; x<N; x++ ){ buffer[index+x] = value[x]; }
     }
     
     /*─······································································─*/
 
     void erase( ulong index ) noexcept {
 	    auto r = get_slice_range( index, size() );
-         if( r == nullptr ){ return; } else { auto n_buffer = ptr_t<T>( last() );
-            for( ulong i=0, j=0; i<size() && !n_buffer.empty(); i++ ){
-             if( i != r[0] ){ n_buffer[j] = buffer[i]; j++; }
-            }   buffer = n_buffer;
-        }
+         if( r == nullptr ){ return; } erase( r[0], r[0] + 1 );
     }
 
     void erase( ulong start, ulong end  ) noexcept {
 	    auto r = get_slice_range( start, end );
-         if( r == nullptr ){ return; } else {
-            if( r[0] >= size() || r[1] >= size() ) erase( last() );
-            auto n_buffer = ptr_t<T>( size() - ( r[1] - r[0] ) - 1 );
-            for( ulong i=0, j=0; i<size() && !n_buffer.empty(); i++ ){
-             if( i < r[0] || i > r[1] ){ n_buffer[j] = buffer[i]; j++; }
-            }   buffer = n_buffer;
-        }
+         if( r == nullptr ){ return; } grow( length ); auto a = &buffer;
+        for( ulong x=r[0]; x+r[2]<length; x++ ){ a[x] = type::move( a[x+r[2]] ); }
+        for( ulong x=length-r[2]; x<length; x++ ){ a[x] = T(); } length -= r[2];
     }
     
     /*─······································································─*/
 
     string_t join( string_t c=", " ) const noexcept {
-        if( empty() ){ return ""; } string_t result; 
+        if( empty() ){ return ""; } string_builder_t result; 
         for( auto x=begin(); x!=end(); x++ ){
-            result += string::to_string(*x) + ((x==end()-1)?"":c);
-        }   return result;
+            if( x != begin() ){ result.append( c ); }
+            result.append( string::to_string(*x) );
+        }   return result.str();
     }
     
     /*─······································································─*/
@@ -361,7 +355,7 @@ public: array_t() noexcept {};
     const T* c_arr() const noexcept { return &buffer; }
           T*  data() const noexcept { return &buffer; }
           T*   get() const noexcept { return &buffer; }
-    ptr_t<T>&  ptr() noexcept { return  buffer; }
+    ptr_t<T>&  ptr() noexcept { shrink_to_fit(); return buffer; }
 
 };}
 
@@ -369,12 +363,12 @@ public: array_t() noexcept {};
 
 namespace nodepp { namespace string {
 
-    array_t<string_t> split( string_t _str, char ch ){
-        array_t<string_t> result; int c; while( !_str.empty() ){
-            while((c=_str.index_of([=]( char c ){ return c==ch; }))==0 )
-                 { _str.erase(0); continue; }
-            if( c != -1 ){ result.push(_str.splice( 0, c )); }
-            else         { result.push(_str); break; }
+    array_t<string_t> split( const string_t& _str, char ch ){
+        array_t<string_t> result; ulong x=0; while( x < _str.size() ){
+            if( _str[x] == ch ){ x++; continue; }
+            auto y = _string_::find( _str.get()+x, _str.size()-x, ch );
+            ulong z = y == nullptr ? _str.size() : y - _str.get();
+            result.push( string_t( _str.get()+x, z-x ) ); x = z;
         }   return result;
     }
 
@@ -387,6 +381,16 @@ namespace nodepp { namespace string {
         }   return result;
     }
 
+    /*─······································································─*/
+
+    array_t<string_view_t> split( const string_view_t& _str, char ch ){
+        array_t<string_view_t> result; ulong x=0; while( x < _str.size() ){
+            if( _str[x] == ch ){ x++; continue; } long y = _str.find( ch, x );
+            if( y < 0 ){ y = _str.size(); }
+            result.push( string_view_t( _str, x, y - x ) ); x = y;
+        }   return result;
+    }
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_BUILDER
+#define NODEPP_BUILDER
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class string_builder_t {
+protected:
+
+    /* appends land in one geometrically grown buffer, numbers are formatted
+       in place; str() hands that buffer out without copying it */
+
+    string_t data;
+
+    string_builder_t& write( const char* value, ulong n ) noexcept {
+        if( n == 0 ){ return *this; }
+        data.insert( data.size(), n, (char*) value ); return *this;
+    }
+
+    template< class T >
+    string_builder_t& number( const T& value ) noexcept {
+        char buffer[32]; return write( buffer, _number_::format( buffer, value ) );
+    }
+
+public:
+
+    string_builder_t() noexcept {}
+
+    string_builder_t( ulong n ) noexcept { data.reserve( n ); }
+
+    /*─······································································─*/
+
+    string_builder_t& append( char value ) noexcept { data.push( value ); return *this; }
+
+    string_builder_t& append( const char* value ) noexcept {
+        if( value == nullptr ){ return *this; } return write( value, strlen( value ) );
+    }
+
+    string_builder_t& append( const char* value, ulong n ) noexcept { return write( value, n ); }
+
+    string_builder_t& append( const string_t& value ) noexcept { return write( value.get(), value.size() ); }
+
+    string_builder_t& append( const string_view_t& value ) noexcept { return write( value.begin(), value.size() ); }
+
+    /*─······································································─*/
+
+    string_builder_t& append( int    value ) noexcept { return number( (llong)  value ); }
+    string_builder_t& append( long   value ) noexcept { return number( (llong)  value ); }
+    string_builder_t& append( llong  value ) noexcept { return number( (llong)  value ); }
+    string_builder_t& append( uint   value ) noexcept { return number( (ullong) value ); }
+    string_builder_t& append( ulong  value ) noexcept { return number( (ullong) value ); }
+    string_builder_t& append( ullong value ) noexcept { return number( (ullong) value ); }
+    string_builder_t& append( float  value ) noexcept { return number( value ); }
+    string_builder_t& append( double value ) noexcept { return number( value ); }
+
+    template< class T >
+    string_builder_t& operator+=( const T& value ) noexcept { return append( value ); }
+
+    /*─······································································─*/
+
+    void reserve( ulong n ) noexcept { data.reserve( n ); }
+
+    ulong capacity() const noexcept { return data.capacity(); }
+    ulong     size() const noexcept { return data.size(); }
+    bool     empty() const noexcept { return data.empty(); }
+    void     clear() noexcept { data.clear(); }
+
+    /*─······································································─*/
+
+    string_t str() const noexcept { return data; }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
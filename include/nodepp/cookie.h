@@ -27,21 +27,24 @@ namespace nodepp {
 
         cookie_t parse( string_t data ){
             if ( data.empty() ){ return cookie_t(); } cookie_t res;
-                 auto args = string::split( data, ';' );
-            for( auto x : args ){ 
-                 auto y = regex::search( x,"[^=]+");
-                 if ( y == nullptr ){ continue; }
-                 auto name = regex::replace( x.slice(y[0],y[1]), "\\s+", "" );
-                 res[ name ] = x.slice(y[1]+1);
+                 auto args = string::split( string_view_t( data ), ';' );
+            for( auto x : args ){ string_t name; ulong y=0; uchar w=0;
+                 while( y<x.size() && x[y]=='=' ){ y++; }
+                 if ( y >= x.size() ){ continue; } long z = x.find( '=', y );
+                 if ( z < 0 ){ z = x.size(); } for( ; y<(ulong)z; y++ ){
+                 if ( string::is_space(x[y]) && w<2 ){ w=1; continue; }
+                 if ( w==1 ){ w=2; } name.push(x[y]); }
+                 res[ name ] = x.slice(z+1).copy();
             }    return res;
         }
         
         /*─······································································─*/
         
         string_t format( const cookie_t& data ){ 
-            array_t<string_t> result; for( auto x:data.data() ) 
-                   result.push( x.first + "=" + x.second );
-            return string::format("%s",result.join(";").c_str());
+            string_builder_t result; for( auto x:data.data() ){ 
+                if( !result.empty() ){ result.append(';'); }
+                result.append( x.first ).append('=').append( x.second );
+            }   return result.str();
         }
 
     }
@@ -21,16 +21,43 @@ template< class T > T clamp( const T& val, const T& _min, const T& _max ){ retur
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#define NODEPP_KERNEL_WASM   0
+#define NODEPP_KERNEL_NATIVE 1
+
+#ifndef _KERNEL
+#ifdef  __EMSCRIPTEN__
+#define _KERNEL NODEPP_KERNEL_WASM
+#else
+#define _KERNEL NODEPP_KERNEL_NATIVE
+#endif
+#endif
+
+#ifndef NODEPP_MAINLOOP
+#define NODEPP_MAINLOOP 0
+#elif   _KERNEL != NODEPP_KERNEL_WASM
+#undef  NODEPP_MAINLOOP
+#define NODEPP_MAINLOOP 0
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 #define _EERROR( EV, ... ) if  ( EV.empty() ){ console::error(__VA_ARGS__); } \
                            else{ EV.emit( except_t(__VA_ARGS__) ); }
 #define _ERROR( ... )      throw except_t (__VA_ARGS__)
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#if NODEPP_MAINLOOP
+#define onMain INIT(); int main(){ \
+   process::start();  INIT();      \
+   return 0;                       \
+}  void INIT
+#else
 #define onMain INIT(); int main(){ \
    process::start();  INIT();      \
    process::stop(); return 0;      \
 }  void INIT
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -111,12 +138,52 @@ template< class T > T clamp( const T& val, const T& _min, const T& _max ){ retur
 #define MAX_TASKS   1024
 #endif
 
+#ifndef TIMER_WHEEL
+#define TIMER_WHEEL 512
+#endif
+
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #ifndef TIMEOUT
 #define TIMEOUT 1
 #endif
 
+#ifndef FRAME_BUDGET
+#define FRAME_BUDGET 8
+#endif
+
+#ifndef HOST_YIELD
+#define HOST_YIELD 16
+#endif
+
+#ifndef NODEPP_STATS
+#define NODEPP_STATS 1
+#endif
+
+#ifndef NODEPP_TRACE
+#define NODEPP_TRACE 0
+#endif
+
+#ifndef TRACE_SIZE
+#define TRACE_SIZE 4096
+#endif
+
+#ifndef STRING_SSO
+#define STRING_SSO 22
+#endif
+
+#ifndef FUNC_SBO
+#define FUNC_SBO 48
+#endif
+
+#ifndef ARENA_CHUNK
+#define ARENA_CHUNK 16384
+#endif
+
+#ifndef QUEUE_POOL
+#define QUEUE_POOL 256
+#endif
+
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #define typeof(DATA) (string_t){ typeid( DATA ).name() }
@@ -14,7 +14,11 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "wasm/date.cpp"
+#if _KERNEL == NODEPP_KERNEL_WASM
+    #include "wasm/date.cpp"
+#else
+    #include "native/date.cpp"
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -19,7 +19,7 @@ protected:
 
     struct NODE { 
         string_t msg;
-        void* ev = nullptr;
+        handle_t ev;
     };  ptr_t<NODE> obj;
 
 public: debug_t() noexcept : obj(new NODE()) { }
@@ -27,7 +27,7 @@ public: debug_t() noexcept : obj(new NODE()) { }
     /*─······································································─*/
 
     virtual ~debug_t() noexcept { 
-        if ( obj.count() == 2 ){ 
+        if ( obj.count() == 1 ){ 
 	         console::log( obj->msg, "closed" );  
         }    process::onSIGERR.off( obj->ev );
     }
@@ -35,8 +35,10 @@ public: debug_t() noexcept : obj(new NODE()) { }
     /*─······································································─*/
     
     debug_t( const string_t& msg ) noexcept : obj(new NODE()) {
-        obj->msg = msg; auto inp = type::bind( this );
-        obj->ev  = process::onSIGERR([=](){ inp->error(); });
+        obj->msg = msg; weak_ptr_t<NODE> inp = obj;
+        obj->ev  = process::onSIGERR([=](){
+            auto x = inp.lock(); if( !x.null() ){ console::error( x->msg ); }
+        });
 	               console::log( obj->msg, "open" );
     }
     
@@ -14,7 +14,11 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "wasm/env.cpp"
+#if _KERNEL == NODEPP_KERNEL_WASM
+    #include "wasm/env.cpp"
+#else
+    #include "native/env.cpp"
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
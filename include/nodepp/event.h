@@ -17,47 +17,68 @@
 namespace nodepp { template< class... A > class event_t { 
 protected:
 
-    using NODE = function_t<bool,A...>; ptr_t<queue_t<NODE>> obj;
+    /* listeners keep their flag beside the callback, so the ones turned
+       off can be swept when the queue doubles instead of living on until
+       the next emit, which for process::onSIGERR may never come */
 
-public: event_t() noexcept : obj( new queue_t<NODE>() ) {}
+    struct NODE {
+        ptr_t<_handle_::flag_t> out;
+        function_t<void,A...>   cb;
+        bool once = 0;
+    };
+
+    struct DONE {
+        queue_t<NODE> queue;
+        ulong limit = 64;
+        ulong depth = 0;
+    };  ptr_t<DONE> obj;
+    
+    /*─······································································─*/
+
+    void sweep() const noexcept {
+        if( obj->depth != 0 ){ return; }
+        auto x = obj->queue.first(); while( x != nullptr ){ auto y = x->next;
+            if( !x->data.out->alive() ){ obj->queue.erase(x); }
+        x = y; } obj->limit = max( obj->queue.size() * 2, 64UL );
+    }
+
+    handle_t add( const function_t<void,A...>& func, bool once ) const noexcept {
+        _arena_::heap_t heap; if( obj->queue.size() >= obj->limit ){ sweep(); }
+        if( obj->queue.size() >= MAX_EVENTS ){ return nullptr; }
+        NODE item; item.out = ptr_t<_handle_::flag_t>::make();
+        item.cb = func; item.once = once; obj->queue.push( item );
+        return item.out->hdl;
+    }
+
+public: event_t() noexcept : obj( ptr_t<DONE>::make() ) {}
     
     /*─······································································─*/
 
-    void* operator()( function_t<void,A...> func ) const noexcept { return on(func); }
+    handle_t operator()( function_t<void,A...> func ) const noexcept { return on(func); }
     
     /*─······································································─*/
 
-    void off( void* address ) const noexcept { process::clear( address ); }
+    void off( const handle_t& address ) const noexcept { process::clear( address ); }
 
-    void* once( function_t<void,A...> func ) const noexcept {
-        if( obj->size() >= MAX_EVENTS ) { return nullptr; }
-        ptr_t<bool> out = new bool(1); obj->push([=]( A... args ){
-            if( *out != 0 ){ func( args... ); } 
-            *out = 0; return *out;
-        }); return &out;
-    }
+    handle_t once( function_t<void,A...> func ) const noexcept { return add( func, 1 ); }
 
-    void* on( function_t<void,A...> func ) const noexcept {
-        if( obj->size() >= MAX_EVENTS ) { return nullptr; }
-        ptr_t<bool> out = new bool(1); obj->push([=]( A... args ){
-            if( *out != 0 ){ func( args... ); } 
-            return *out;
-        }); return &out;
-    }
+    handle_t   on( function_t<void,A...> func ) const noexcept { return add( func, 0 ); }
     
     /*─······································································─*/
 
-    bool  empty() const noexcept { return obj->empty(); }
-    ulong  size() const noexcept { return obj->size(); }
-    void  clear() const noexcept { obj->clear(); }
+    bool  empty() const noexcept { return obj->queue.empty(); }
+    ulong  size() const noexcept { return obj->queue.size(); }
+    void  clear() const noexcept { obj->queue.clear(); }
     
     /*─······································································─*/
 
     void emit( const A&... args ) const noexcept {
-        auto x = obj->first(); while( x != nullptr ){
-        auto y = x->next; 
-            if( !x->data( args... ) ){ obj->erase(x); }
-        x = y; }
+        if( obj->queue.empty() ){ return; } _trace_::span_t span( "event", "emit" );
+        obj->depth++; auto x = obj->queue.first(); while( x != nullptr ){
+        auto y = x->next; auto& z = x->data;
+            if( z.out->alive() ){ z.cb( args... ); if( z.once ){ z.out->close(); } }
+            if(!z.out->alive() ){ obj->queue.erase(x); }
+        x = y; } obj->depth--;
     }
     
 };}
@@ -18,7 +18,7 @@ namespace nodepp { class except_t {
 protected: 
 
     struct NODE { 
-        void *ev = nullptr;
+        handle_t ev;
         string_t msg;
     };  ptr_t<NODE> obj;
 
@@ -31,27 +31,40 @@ public:
 
     except_t() noexcept : obj( new NODE() ) {}
 
+protected:
+
+    /* a thrown except_t leaves a listener on process::onSIGERR, so its
+       state is kept off any active arena; it may outlive the scope that
+       threw it, e.g. a json::parse run inside one */
+
+    static ptr_t<NODE> node() noexcept { return _arena_::make<ptr_t<NODE>>( new NODE() ); }
+
+    void listen() const noexcept { weak_ptr_t<NODE> inp = obj;
+        obj->ev = process::onSIGERR.once([=]( ... ){
+            auto x = inp.lock(); if( x.null() ){ return; } console::error( x->msg );
+        });
+    }
+
+public:
+
     /*─······································································─*/
 
     template< class T, class = typename type::enable_if<type::is_class<T>::value,T>::type >
-    except_t( const T& except_type ) noexcept : obj(new NODE()) {
-        obj->msg = except_type.what(); auto inp = type::bind( this ); 
-        obj->ev  = process::onSIGERR.once([=]( ... ){ inp->print(); });
+    except_t( const T& except_type ) noexcept : obj( node() ) { _arena_::heap_t heap;
+        obj->msg = except_type.what(); listen();
     }
 
     /*─······································································─*/
 
     template< class... T >
-    except_t( const T&... msg ) noexcept : obj(new NODE()) {
-        obj->msg = string::join( " ", msg... ); auto inp = type::bind( this ); 
-        obj->ev  = process::onSIGERR.once([=]( ... ){ inp->print(); });
+    except_t( const T&... msg ) noexcept : obj( node() ) { _arena_::heap_t heap;
+        obj->msg = string::join( " ", msg... ); listen();
     }
 
     /*─······································································─*/
 
-    except_t( const string_t& msg ) noexcept : obj(new NODE()) {
-        obj->msg = msg; auto inp = type::bind( this ); 
-        obj->ev  = process::onSIGERR.once([=]( ... ){ inp->print(); });
+    except_t( const string_t& msg ) noexcept : obj( node() ) { _arena_::heap_t heap;
+        obj->msg = heap.paused() ? msg.copy() : msg; listen();
     }
 
     /*─······································································─*/
@@ -18,31 +18,53 @@ namespace nodepp { template< class V, class... T > class function_t {
 public:
     
     template< class F >
-    function_t( F f ) : func_ptr( new func_impl<F>(f) ) {}
+    function_t( F f ) { set( f ); }
    
-    function_t() noexcept : func_ptr(nullptr) {}
+    function_t() noexcept {}
     
-    virtual ~function_t() noexcept = default;
+    virtual ~function_t() noexcept { reset(); }
     
     /*─······································································─*/
 
-    bool has_value() const noexcept { return func_ptr.has_value(); }
-    ulong    count() const noexcept { return func_ptr.count(); }
-    bool     empty() const noexcept { return func_ptr.null(); }
-    void      free() const noexcept { func_ptr.free(); }
+    function_t( const function_t& other ) noexcept { cpy( other ); }
+
+    function_t( function_t&& other ) noexcept { mve( other ); }
+
+    function_t& operator=( const function_t& other ) noexcept {
+        if( this != &other ){ reset(); cpy( other ); } return *this;
+    }
+
+    function_t& operator=( function_t&& other ) noexcept {
+        if( this != &other ){ reset(); mve( other ); } return *this;
+    }
+    
+    /*─······································································─*/
+
+    bool has_value() const noexcept { return mode == 1 || func_ptr.has_value(); }
+    ulong    count() const noexcept { return mode == 1 ? 1 : func_ptr.count(); }
+    bool     empty() const noexcept { return mode == 0; }
+
+    /* releases the callable; a shared one goes for every copy, as it
+       always has, but an inline one belongs to each copy alone, so only
+       this copy lets it go while the others keep theirs */
+
+    void      free() noexcept { 
+        if( mode == 1 ){ reset(); } 
+      elif( mode == 2 ){ func_ptr.free(); }
+    }
     
     /*─······································································─*/
 
-    explicit operator bool(void) const noexcept { return func_ptr.null(); }
+    explicit operator bool(void) const noexcept { return mode == 0; }
     
     V operator()( const T&... arg ) const { 
-        if( func_ptr == nullptr ) return V();
-        return func_ptr->invoke(arg...); 
+        if( mode == 0 ) return V();
+        return get()->invoke(arg...); 
     }
     
     V emit( const T&... arg ) const { 
-        if( func_ptr == nullptr ) return V();
-        return func_ptr->invoke(arg...); 
+        if( mode == 0 ) return V();
+        return get()->invoke(arg...); 
     }
     
 private:
@@ -50,25 +72,85 @@ private:
     class func_base { public:
         virtual ~func_base() {}
         virtual V invoke( const T&... arg ) const = 0;
+        virtual void copy( void* addr ) const = 0;
+        virtual void move( void* addr ) = 0;
     };
     
     /*─······································································─*/
     
+    template< class F > struct fits;
+
+    /* copy and move only ever target local, so they place a func_impl
+       there only for callables that fit it; for the rest they are never
+       called, and compile to nothing so GCC has no oversized placement
+       to warn about */
+
     template< class F >
     class func_impl : public func_base {
 
     public:
 
         func_impl( const F& f ) : func(f) {}
+        func_impl( F&& f ) : func( type::move(f) ) {}
         virtual V invoke( const T&... arg ) const { return func(arg...); }
+        virtual void copy( void* addr ) const { copy( addr, typename fits<F>::type() ); }
+        virtual void move( void* addr ) { move( addr, typename fits<F>::type() ); }
 
     private:
         F func;
+
+        void copy( void* addr, type::true_type ) const { new ( addr ) func_impl( func ); }
+        void move( void* addr, type::true_type ) { new ( addr ) func_impl( type::move(func) ); }
+        void copy( void*, type::false_type ) const {}
+        void move( void*, type::false_type ) {}
     };
     
     /*─······································································─*/
+
+    /* callables up to FUNC_SBO bytes live in local and are copied along
+       with the function_t, so building, copying and dropping one never
+       touches the allocator; bigger ones go to func_ptr and are shared.
+       Which storage a callable gets is decided at compile time by fits,
+       and mode records it: 0 empty, 1 local, 2 shared */
+
+    ptr_t<func_base> func_ptr; uchar mode = 0;
+    alignas( void* ) char local[ FUNC_SBO ];
+
+    func_base* get() const noexcept {
+        return mode == 1 ? (func_base*) local : func_ptr.get();
+    }
+
+    template< class F > struct fits : type::conditional< 
+        sizeof( func_impl<F> ) <= FUNC_SBO && alignof( func_impl<F> ) <= alignof( void* ),
+        type::true_type, type::false_type
+    >::type {};
+
+    template< class F >
+    typename type::enable_if< fits<F>::value >::type set( F& f ) noexcept {
+        new ( local ) func_impl<F>( type::move(f) ); mode = 1;
+    }
+
+    template< class F >
+    typename type::enable_if<!fits<F>::value >::type set( F& f ) noexcept {
+        func_ptr = ptr_t<func_impl<F>>::make( f ); mode = 2;
+    }
     
-    ptr_t<func_base> func_ptr;
+    /*─······································································─*/
+
+    void cpy( const function_t& other ) noexcept {
+        if( other.mode == 1 ){ other.get()->copy( local ); mode = 1; }
+      elif( other.mode == 2 ){ func_ptr = other.func_ptr;  mode = 2; }
+    }
+
+    void mve( function_t& other ) noexcept {
+        if( other.mode == 1 ){ other.get()->move( local ); mode = 1; other.reset(); }
+      elif( other.mode == 2 ){ func_ptr = type::move( other.func_ptr ); mode = 2; other.mode = 0; }
+    }
+
+    void reset() noexcept {
+        if( mode == 1 ){ get()->~func_base(); }
+      elif( mode == 2 ){ func_ptr.reset(); } mode = 0;
+    }
     
 };}
 
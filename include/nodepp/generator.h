@@ -13,86 +13,6 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#if !defined(GENERATOR_TIMER) && defined(NODEPP_TIMER) && defined(NODEPP_GENERATOR)
-    #define  GENERATOR_TIMER
-namespace nodepp { namespace _timer_ {
-
-    GENERATOR( timer ){ public:
-
-        template< class V, class... T > 
-        coEmit( V func, ulong time, const T&... args ){
-        gnStart
-            coDelay( time ); if( func(args...)<0 )
-                   { coEnd; } coGoto(0); 
-        gnStop
-        }
-
-        template< class V, class... T > 
-        coEmit( V func, ulong* time, const T&... args ){
-        gnStart
-            coDelay( *time ); if( func(args...)<0 )
-                   { coEnd; } coGoto(0); 
-        gnStop
-        }
-
-    };
-    
-    /*─······································································─*/
-
-    GENERATOR( utimer ){ public:
-
-        template< class V, class... T > 
-        coEmit( V func, ulong time, const T&... args ){
-        gnStart
-            coUDelay( time ); if( func(args...)<0 )
-                    { coEnd; } coGoto(0);
-        gnStop
-        }
-
-        template< class V, class... T > 
-        coEmit( V func, ulong* time, const T&... args ){
-        gnStart
-            coUDelay( *time ); if( func(args...)<0 )
-                    { coEnd; } coGoto(0);
-        gnStop
-        }
-
-    };
-
-}}  
-#undef NODEPP_GENERATOR
-#endif
-
-/*────────────────────────────────────────────────────────────────────────────*/
-
-#if !defined(GENERATOR_PROMISE) && defined(NODE_PROMISE) && defined(NODEPP_GENERATOR)
-    #define  GENERATOR_PROMISE
-namespace nodepp { namespace _promise_ {
-
-    GENERATOR( resolve ){ public:
-
-        template< class T, class U, class V > 
-        coEmit( ptr_t<bool> state, const T& func, const U& res, const V& rej ){
-        gnStart
-            func( res, rej ); while( *state==1 ) { coNext; }
-        gnStop
-        }
-
-        template< class T, class U > 
-        coEmit( ptr_t<bool> state, const T& func, const U& res ){
-        gnStart
-            func( res ); while( *state==1 ) { coNext; }
-        gnStop
-        }
-
-    };
-
-}}  
-#undef NODEPP_GENERATOR
-#endif
-
-/*────────────────────────────────────────────────────────────────────────────*/
-
 #if !defined(GENERATOR_FILE) && defined(NODEPP_FILE) && defined(NODEPP_GENERATOR)
     #define  GENERATOR_FILE
 namespace nodepp { namespace _file_ {
@@ -206,7 +126,8 @@ namespace nodepp { namespace _file_ {
         while( str->is_available() ){
         while( _read(str) == 1 ){ coNext; }
            if( _read.state<= 0 ){ break; } state = 1; s += _read.data; 
-          for( auto &x: s )     { if( x == ch ){ break; } state++; }
+           auto x = _string_::find( s.get(), s.size(), ch );
+           state = x == nullptr ? s.size()+1 : x - s.get() + 1;
            if( state<=s.size() ){ break; }
         }      str->set_borrow(s);
 
@@ -233,7 +154,8 @@ namespace nodepp { namespace _file_ {
         while( str->is_available() ){
         while( _read(str) == 1 ){ coNext; }
            if( _read.state<= 0 ){ break; } state = 1; s += _read.data; 
-          for( auto &x: s )     { if( x == '\n' ){ break; } state++; }
+           auto x = _string_::find( s.get(), s.size(), '\n' );
+           state = x == nullptr ? s.size()+1 : x - s.get() + 1;
            if( state<=s.size() ){ break; }
         }      str->set_borrow(s);
 
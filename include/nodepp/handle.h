@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_HANDLE
+#define NODEPP_HANDLE
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { struct handle_t {
+
+    uint idx = 0; uint gen = 0;
+
+    handle_t() noexcept {}
+    handle_t( decltype(nullptr) ) noexcept {}
+    handle_t( uint idx, uint gen ) noexcept : idx( idx ), gen( gen ) {}
+
+    /*─······································································─*/
+
+    bool operator==( const handle_t& x ) const noexcept { return idx==x.idx && gen==x.gen; }
+    bool operator!=( const handle_t& x ) const noexcept { return idx!=x.idx || gen!=x.gen; }
+    explicit operator bool() const noexcept { return gen != 0; }
+    bool null() const noexcept { return gen == 0; }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _handle_ {
+
+    struct SLOT {
+        void*   addr = nullptr;
+        void  (*kill)( void* ) = nullptr;
+        uint    gen  = 1;
+        uint    next = 0;
+    };
+
+    SLOT* slot = nullptr; uint cap = 0, top = 1, pool = 0;
+
+    /*─······································································─*/
+
+    SLOT* get( const handle_t& x ) noexcept {
+        if( x.idx == 0 || x.idx >= top ){ return nullptr; }
+        return slot[x.idx].gen == x.gen ? &slot[x.idx] : nullptr;
+    }
+
+    bool alive( const handle_t& x ) noexcept { return get( x ) != nullptr; }
+
+    /*─······································································─*/
+
+    handle_t alloc( void* addr=nullptr, void (*kill)( void* )=nullptr ) noexcept {
+        uint idx = pool; if( idx != 0 ){ pool = slot[idx].next; } else {
+        if( top >= cap ){ uint len = cap == 0 ? 64 : cap * 2;
+            auto tmp = new SLOT[ len ]; for( uint i=0; i<cap; i++ ){ tmp[i] = slot[i]; }
+            delete [] slot; slot = tmp; cap = len;
+        }   idx = top++; }
+        slot[idx].addr = addr; slot[idx].kill = kill; slot[idx].next = 0;
+        return handle_t( idx, slot[idx].gen );
+    }
+
+    void release( const handle_t& x ) noexcept {
+        auto y = get( x ); if( y == nullptr ){ return; }
+        y->gen = y->gen + 1 == 0 ? 1 : y->gen + 1;
+        y->addr = nullptr; y->kill = nullptr;
+        y->next = pool; pool = x.idx;
+    }
+
+    bool clear( const handle_t& x ) noexcept {
+        auto y = get( x ); if( y == nullptr ){ return 0; }
+        auto addr = y->addr; auto kill = y->kill; release( x );
+        if( kill != nullptr ){ kill( addr ); } return 1;
+    }
+
+    /*─······································································─*/
+
+    class flag_t {
+    public: handle_t hdl;
+        flag_t() noexcept : hdl( alloc() ) {}
+       ~flag_t() noexcept { release( hdl ); }
+        bool alive() const noexcept { return _handle_::alive( hdl ); }
+        void close() const noexcept { release( hdl ); }
+    };
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
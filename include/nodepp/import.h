@@ -15,7 +15,9 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #include <typeinfo>
+#include <new>
 #include <cstring>
+#include <cerrno>
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
@@ -33,7 +35,10 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#include "number.h"
 #include "string.h"
+#include "view.h"
+#include "builder.h"
 #include "array.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -41,6 +46,8 @@
 #include "iterator.h"
 #include "console.h"
 #include "sleep.h"
+#include "handle.h"
+#include "trace.h"
 #include "task.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -23,7 +23,7 @@
 namespace nodepp { class json_t {
 protected:
 
-    long get_next_sec( ulong _pos, const string_t& str ) const noexcept {
+    long get_next_sec( ulong _pos, const string_view_t& str ) const noexcept {
         uchar k=0; while( _pos < str.size() ){     
             switch( str[_pos] ){
                 case ':': k += 6; break; case ',': k -= 6; break;
@@ -36,7 +36,7 @@ protected:
         }   return _pos >= str.size() ? -1 : _pos;
     }
 
-    long get_next_key( ulong _pos, const string_t& str ) const noexcept {
+    long get_next_key( ulong _pos, const string_view_t& str ) const noexcept {
         bool x=1; uchar k=0; while( _pos < str.size() ){   
             switch( str[_pos] ){
                 case '[': k += 1; break; case ']': k -= 1; break; 
@@ -50,25 +50,43 @@ protected:
         }   return _pos >= str.size() ? -1 : _pos;
     }
 
-    object_t get_data( const string_t& data ) const noexcept {
+    string_t get_text( const string_view_t& data ) const noexcept {
+        long x = data.find('"'); while( x >= 0 && data[x+1] == '"' ){ x++; }
+        if  ( x < 0 || (ulong) x+1 >= data.size() ){ return nullptr; }
+        long y = data.find( '"', x+1 ); if( y < 0 ){ return nullptr; }
+        return data.slice( x+1, y ).copy();
+    }
+
+    bool get_lower( const string_view_t& data ) const noexcept {
+        for( auto x=data.begin(); x!=data.end(); x++ )
+           { if( string::is_lower(*x) ){ return true; } } return false;
+    }
+
+    ulong get_digits( const string_view_t& data ) const noexcept {
+        ulong x=1; while( x < data.size() && !string::is_digit(data[x]) ){ x++; }
+        ulong y=x; while( y < data.size() &&  string::is_digit(data[y]) ){ y++; }
+        return x >= data.size() ? 0 : y - x + 1;
+    }
+
+    object_t get_data( const string_view_t& data ) const noexcept {
         ulong x=0; while( x < data.size() && data[x]==' ' ){ x++; }
           if( data.empty() || data[x] == ',' )       { return nullptr; }
-        elif( data[x] == '"'     )                   { return regex::match(data,"\"[^\"]+\"").slice(1,-1); }
+        elif( data[x] == '"'     )                   { return get_text( data ); }
         elif( data[x] == '{'     )                   { return parse( data ); }
         elif( data[x] == '['     )                   { return parse( data ); }
-        elif( data.find("false") )                   { return (bool) 0; }
-        elif( data.find("true")  )                   { return (bool) 1; }
-        elif( data.find("null")  )                   { return nullptr;  }
-        elif( regex::test(data,"[a-z]") )            { return (string_t) data; }
-        elif( data.find('.')     ){
-            if( regex::match(data,".\\d+").size()>5 ){ return string::to_double(data); }
-            else                                     { return string::to_float(data);  }
-        }   elif( data.size() > 9 )                  { return string::to_long(data);   }
-            else                                     { return string::to_int(data);    } 
+        elif( data.find("false") >=0 )               { return (bool) 0; }
+        elif( data.find("true")  >=0 )               { return (bool) 1; }
+        elif( data.find("null")  >=0 )               { return nullptr;  }
+        elif( get_lower( data )  )                   { return data.copy(); }
+        elif( data.find('.')     >=0 ){
+            if( get_digits( data ) > 5 )             { return string::to_double(data.copy()); }
+            else                                     { return string::to_float(data.copy());  }
+        }   elif( data.size() > 9 )                  { return string::to_long(data.copy());   }
+            else                                     { return string::to_int(data.copy());    } 
     }
 
-    object_t get_object( ulong x, ulong y, const string_t& str ) const {
-        object_t result; do { type::pair<string_t,string_t> data;
+    object_t get_object( ulong x, ulong y, const string_view_t& str ) const {
+        object_t result; do { type::pair<string_view_t,string_view_t> data;
            if( string::is_space(str[x]) ){ continue; }
            if( str[x] == '"' ){
                auto z = get_next_sec( x, str ); 
@@ -77,12 +95,12 @@ protected:
                auto w = get_next_sec( x, str ); 
                     w = w<0 ? str.size()-1 : w;
                data.second = str.slice( x+1, w ); x=w;
-               result[data.first] = get_data( data.second );
+               result[data.first.copy()] = get_data( data.second );
             }
-        } while( x++<y ); return result.keys().empty() ? nullptr : result;
+        } while( x++<y ); return result.size() == 0 ? nullptr : result;
     }
 
-    array_t<object_t> get_array( ulong x, ulong y, const string_t& str ) const {
+    array_t<object_t> get_array( ulong x, ulong y, const string_view_t& str ) const {
         array_t<object_t> data; do {
            if( string::is_space(str[x]) || str[x]==',' ){ continue; }
            if( str[x] == '{' || str[x] == '[' ){
@@ -100,9 +118,88 @@ protected:
         } while( x++<y ); return data;
     }
     
+    template< class T >
+    void put_array( const array_t<T>& list, string_builder_t& out ) const noexcept {
+        out.append('['); for( ulong x=0; x<list.size(); x++ ){
+            if( x > 0 ){ out.append(", "); } out.append( string::to_string( list[x] ) );
+        }   out.append(']');
+    }
+
+    void put_data( const object_t& obj, string_builder_t& out ) const noexcept {
+        if( !obj.has_value() ){ return; } bool sep=0; /*process::next();*/
+
+        switch( obj.get_type_id() ){
+
+            case 0x0014: out.append('{');
+                for( auto &item: obj.as<map_t<string_t,object_t>>().data() ){
+                     if( !item.second.has_value() ){ continue; } if( sep ){ out.append(','); }
+                     out.append('"').append( item.first.get() ).append("\":");
+                     put_data( item.second, out ); sep=1;
+                }   out.append('}');
+            break;
+
+            case 0x0015: out.append('[');
+                for( auto &item: obj.as<array_t<object_t>>() ){
+                     if( sep ){ out.append(','); } put_data( item, out ); sep=1;
+                }   out.append(']');
+            break;
+
+            case 0x0001: out.append( obj.as<int>() );                                          break;
+            case 0x0002: out.append( obj.as<uint>() );                                         break;
+            case 0x0003: out.append( obj.as<bool>() ? "true" : "false" );                      break;
+            case 0x0004: out.append('"').append( obj.as<char>() ).append('"');                 break;
+            case 0x0005: out.append( obj.as<long>() );                                         break;
+            case 0x0006: out.append( string::to_string( obj.as<short>() ) );                   break;
+            case 0x0007: out.append( string::to_string( obj.as<uchar>() ) );                   break;
+            case 0x0008: out.append( obj.as<llong>() );                                        break;
+            case 0x0009: out.append( obj.as<ulong>() );                                        break;
+            case 0x000a: out.append( string::to_string( obj.as<ushort>() ) );                  break;
+            case 0x000b: out.append( obj.as<ullong>() );                                       break;
+            case 0x000c: out.append( string::to_string( obj.as<wchar_t>() ) );                 break;
+            case 0x000d: out.append( string::to_string( obj.as<char16_t>() ) );                break;
+            case 0x000e: out.append( string::to_string( obj.as<char32_t>() ) );                break;
+            case 0x000f: out.append( obj.as<float>() );                                        break;
+            case 0x0010: out.append( obj.as<double>() );                                       break;
+            case 0x0011: out.append( string::to_string( obj.as<ldouble>() ) );                 break;
+            case 0x0012: out.append('"').append( obj.as<string_t>().get() ).append('"');       break;
+
+            case 0xfA03: out.append('[');
+                for( auto &x: obj.as<array_t<bool>>() ){
+                     if( sep ){ out.append(','); } out.append( x ? "\"true\"" : "\"false\"" ); sep=1;
+                }   out.append(']');
+            break;
+
+            case 0xfA04: out.append('[');
+                for( auto &x: obj.as<array_t<char>>() ){
+                     if( sep ){ out.append(','); } out.append('"').append( x ).append('"'); sep=1;
+                }   out.append(']');
+            break;
+
+            case 0xfA01: put_array( obj.as<array_t<int>>(), out );      break;
+            case 0xfA02: put_array( obj.as<array_t<uint>>(), out );     break;
+            case 0xfA05: put_array( obj.as<array_t<long>>(), out );     break;
+            case 0xfA06: put_array( obj.as<array_t<short>>(), out );    break;
+            case 0xfA07: put_array( obj.as<array_t<uchar>>(), out );    break;
+            case 0xfA08: put_array( obj.as<array_t<llong>>(), out );    break;
+            case 0xfA09: put_array( obj.as<array_t<ulong>>(), out );    break;
+            case 0xfA0a: put_array( obj.as<array_t<ushort>>(), out );   break;
+            case 0xfA0b: put_array( obj.as<array_t<ullong>>(), out );   break;
+            case 0xfA0c: put_array( obj.as<array_t<wchar_t>>(), out );  break;
+            case 0xfA0d: put_array( obj.as<array_t<char16_t>>(), out ); break;
+            case 0xfA0e: put_array( obj.as<array_t<char32_t>>(), out ); break;
+            case 0xfA0f: put_array( obj.as<array_t<float>>(), out );    break;
+            case 0xfA10: put_array( obj.as<array_t<double>>(), out );   break;
+            case 0xfA11: put_array( obj.as<array_t<ldouble>>(), out );  break;
+            case 0xfA12: put_array( obj.as<array_t<string_t>>(), out ); break;
+
+            default: out.append("{}"); break;
+        }
+
+    }
+    
 public: json_t () noexcept = default;
 
-    object_t parse( const string_t& str ) const {
+    object_t parse( const string_view_t& str ) const {
         if( str.empty() ){ return nullptr; }
         ulong x = 0; string_t data; /*process::next();*/ do {
 
@@ -115,7 +212,7 @@ public: json_t () noexcept = default;
                 } elif( str[x] == '{' ) {
                     return get_object( x+1,pos, str );
                 } else {
-                    data = str.slice( x+1, pos-1 ); break;
+                    data = str.slice( x+1, pos-1 ).copy(); break;
                 }   x = pos + 1;               
 
             } elif( str[x] == ']' || str[x] == '}' || str[x] == ')' ){ 
@@ -130,83 +227,10 @@ public: json_t () noexcept = default;
 
     string_t stringify( const object_t& obj ) const { 
         if( !obj.has_value() ){ return nullptr; }
-        string_t result; /*process::next();*/
-
-        if( obj.get_type_id() == 20 ){
-            result.push('{');
-
-            for( auto &item: obj.as<queue_t<type::pair<string_t,object_t>>>().data() ){
-                 result += string::format("\"%s\":",item.first.get());
-                 result += stringify( item.second ); result.push(',');
-            }    result.pop();
-
-            result.push('}'); goto END;
-        } elif( obj.get_type_id() == 21 ){
-            result.push('[');
-
-            for( auto &item: obj.as<array_t<object_t>>() )
-               { result += stringify( item ); result.push(','); }
-            if ( result[ result.size()-1 ] == ',' ){ result.pop(); }
-
-            result.push(']'); goto END;
-        }
-
-        switch( obj.get_type_id() ){
-
-            case 0x0001: return string::to_string( obj.as<int>() );                              break;
-            case 0x0002: return string::to_string( obj.as<uint>() );                             break;
-            case 0x0003: return obj.as<bool>() ? "true" : "false";                               break;
-            case 0x0004: return string::format("\"%c\"",obj.as<char>());                         break;
-            case 0x0005: return string::to_string( obj.as<long>() );                             break;
-            case 0x0006: return string::to_string( obj.as<short>() );                            break;
-            case 0x0007: return string::to_string( obj.as<uchar>() );                            break;
-            case 0x0008: return string::to_string( obj.as<llong>() );                            break;
-            case 0x0009: return string::to_string( obj.as<ulong>() );                            break;
-            case 0x000a: return string::to_string( obj.as<ushort>() );                           break;
-            case 0x000b: return string::to_string( obj.as<ullong>() );                           break;
-            case 0x000c: return string::to_string( obj.as<wchar_t>() );                          break;
-            case 0x000d: return string::to_string( obj.as<char16_t>() );                         break;
-            case 0x000e: return string::to_string( obj.as<char32_t>() );                         break;
-            case 0x000f: return string::to_string( obj.as<float>() );                            break;
-            case 0x0010: return string::to_string( obj.as<double>() );                           break;
-            case 0x0011: return string::to_string( obj.as<ldouble>() );                          break;
-            case 0x0012: return string::format("\"%s\"",obj.as<string_t>().get());               break;
-
-            case 0xfA03: do { result.push('[');
-             for( auto &x: obj.as<array_t<bool>>() )
-                { result += string::format("\"%s\",",x ? "true":"false" ); }   
-             if ( result[ result.size()-1 ] == ',' ){ result.pop(); } 
-            result.push(']'); } while(0); break;
-
-            case 0xfA04: do { result.push('[');
-             for( auto &x: obj.as<array_t<char>>() )
-                { result += string::format("\"%c\",", x ); }
-             if ( result[ result.size()-1 ] == ',' ){ result.pop(); } 
-            result.push(']'); } while(0); break;
-            
-            case 0xfA01: return string::format("[%s]",obj.as<array_t<int>>().join().get());      break;
-            case 0xfA02: return string::format("[%s]",obj.as<array_t<uint>>().join().get());     break;
-            case 0xfA05: return string::format("[%s]",obj.as<array_t<long>>().join().get());     break;
-            case 0xfA06: return string::format("[%s]",obj.as<array_t<short>>().join().get());    break;
-            case 0xfA07: return string::format("[%s]",obj.as<array_t<uchar>>().join().get());    break;
-            case 0xfA08: return string::format("[%s]",obj.as<array_t<llong>>().join().get());    break;
-            case 0xfA09: return string::format("[%s]",obj.as<array_t<ulong>>().join().get());    break;
-            case 0xfA0a: return string::format("[%s]",obj.as<array_t<ushort>>().join().get());   break;
-            case 0xfA0b: return string::format("[%s]",obj.as<array_t<ullong>>().join().get());   break;
-            case 0xfA0c: return string::format("[%s]",obj.as<array_t<wchar_t>>().join().get());  break;
-            case 0xfA0d: return string::format("[%s]",obj.as<array_t<char16_t>>().join().get()); break;
-            case 0xfA0e: return string::format("[%s]",obj.as<array_t<char32_t>>().join().get()); break;
-            case 0xfA0f: return string::format("[%s]",obj.as<array_t<float>>().join().get());    break;
-            case 0xfA10: return string::format("[%s]",obj.as<array_t<double>>().join().get());   break;
-            case 0xfA11: return string::format("[%s]",obj.as<array_t<ldouble>>().join().get());  break;
-            case 0xfA12: return string::format("[%s]",obj.as<array_t<string_t>>().join().get()); break; 
-
-            default: return "{}"; break;
-        }
-
-        END:; return result;
+        string_builder_t result; put_data( obj, result ); return result.str();
     }
 
+
 };}
 
 /*────────────────────────────────────────────────────────────────────────────*/
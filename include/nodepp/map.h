@@ -14,42 +14,142 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { namespace _map_ {
+
+    template< class T >
+    ulong hash( const T& key ) noexcept {
+        ulong out = 2166136261UL; auto data = key.data();
+        for( ulong x=0; x<key.size(); x++ ){
+             out = ( out ^ (uint8) data[x] ) * 16777619UL;
+        }    return out == 0 ? 1 : out;
+    }
+
+    template< class T >
+    bool equal( const T& a, const T& b ) noexcept {
+        if( a.size() != b.size() ){ return false; }
+        return memcmp( a.data(), b.data(), a.size() ) == 0;
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace nodepp { template<class U, class V> class map_t { 
 protected:
 
-    using T = type::pair< U, V >;
+    using T    = type::pair< U, V >;
+    using ITEM = typename queue_t<T>::NODE*;
+
+    struct SLOT {
+        ITEM  node = nullptr;
+        ulong hash = 0;
+    };
 
     struct NODE {
         queue_t<T> queue;
+        SLOT* slot = nullptr; 
+        ulong cap  = 0, used = 0;
+       ~NODE() noexcept { delete [] slot; }
     };  ptr_t<NODE> obj;
 
+    /*─······································································─*/
+
+    ulong distance( ulong idx, ulong hash ) const noexcept {
+          return ( idx - hash ) & ( obj->cap - 1 );
+    }
+
+    ITEM find( const U& id, ulong hash ) const noexcept {
+        if( obj->cap == 0 ){ return nullptr; }
+        ulong mask = obj->cap - 1, idx = hash & mask;
+
+        for( ulong dist=0; dist<obj->cap; dist++ ){
+            auto &x = obj->slot[idx]; 
+            if( x.node == nullptr )              { return nullptr; }
+            if( distance( idx, x.hash ) < dist ) { return nullptr; }
+            if( x.hash == hash && _map_::equal( x.node->data.first, id ) )
+              { return x.node; } idx = ( idx + 1 ) & mask;
+        }
+
+        return nullptr;
+    }
+
+    void index( ITEM node, ulong hash ) const noexcept {
+        SLOT cur; cur.node = node; cur.hash = hash; 
+        ulong mask = obj->cap - 1, idx = hash & mask, dist = 0;
+
+        while( obj->slot[idx].node != nullptr ){
+            ulong tmp = distance( idx, obj->slot[idx].hash );
+            if( tmp < dist ){ type::swap( cur, obj->slot[idx] ); dist = tmp; }
+            idx = ( idx + 1 ) & mask; dist++;
+        }
+
+        obj->slot[idx] = cur; obj->used++;
+    }
+
+    void unindex( ITEM node, ulong hash ) const noexcept {
+        if( obj->cap == 0 ){ return; }
+        ulong mask = obj->cap - 1, idx = hash & mask;
+
+        while( obj->slot[idx].node != node ){
+           if( obj->slot[idx].node == nullptr ){ return; }
+               idx = ( idx + 1 ) & mask;
+        }
+
+        ulong nxt = ( idx + 1 ) & mask;
+        while( obj->slot[nxt].node != nullptr && distance( nxt, obj->slot[nxt].hash ) != 0 ){
+               obj->slot[idx] = obj->slot[nxt]; idx = nxt; nxt = ( nxt + 1 ) & mask;
+        }
+
+        obj->slot[idx] = SLOT(); obj->used--;
+    }
+
+    void rehash( ulong len ) const noexcept {
+        delete [] obj->slot; obj->slot = new SLOT[ len ];
+        obj->cap = len; obj->used = 0;
+
+        auto x = obj->queue.first(); while( x != nullptr ){
+        if( !x->data.first.empty() ){ index( x, _map_::hash( x->data.first ) ); }
+            x = x->next;
+        }
+    }
+
+    ITEM append( const T& item, ulong hash ) const noexcept {
+        if( ( obj->used + 1 ) * 4 > obj->cap * 3 )
+          { rehash( obj->cap == 0 ? 16 : obj->cap * 2 ); }
+        obj->queue.push( item ); auto x = obj->queue.last();
+        index( x, hash ); return x;
+    }
+
+    void insert( const T& item ) const noexcept {
+        if( item.first.empty() ){ obj->queue.push( item ); return; }
+        auto hash = _map_::hash( item.first );
+        if( find( item.first, hash ) == nullptr ){ append( item, hash ); }
+    }
+
 public: 
 
     template< class... O >
-    map_t( const T& argc, const O&... args ) noexcept : obj(new NODE()) {
-        iterator::map([&]( T arg ){ obj->queue.push(arg); }, argc, args... );
+    map_t( const T& argc, const O&... args ) noexcept : obj( ptr_t<NODE>::make() ) {
+        iterator::map([&]( T arg ){ insert(arg); }, argc, args... );
     }
 
     template< ulong N >
-    map_t( const T (&args) [N] ) noexcept : obj(new NODE()) { 
-        for( auto &x: args ){ obj->queue.push(x); }
+    map_t( const T (&args) [N] ) noexcept : obj( ptr_t<NODE>::make() ) { 
+        for( auto &x: args ){ insert(x); }
     }
     
-    map_t() noexcept : obj(new NODE()) {}
+    map_t() noexcept : obj( ptr_t<NODE>::make() ) {}
 
     /*─······································································─*/
 
     V& operator[]( const U& id ) const noexcept { 
-        auto x = obj->queue.first(); 
-        
-        while( !id.empty() && x != nullptr ){
-            if ( x->data.first == id )
-               { return x->data.second; } 
-            else x = x->next; 
-        }
-
+        if( id.empty() ){
                obj->queue.push({ id, V() }); 
-        return obj->queue.last()->data.second;
+        return obj->queue.last()->data.second; }
+
+        auto hash = _map_::hash( id ); auto x = find( id, hash );
+        if( x != nullptr ){ return x->data.second; }
+        return append({ id, V() }, hash )->data.second;
     }
 
     /*─······································································─*/
@@ -67,21 +167,17 @@ public:
     /*─······································································─*/
 
     bool has( const U& id ) const noexcept {
-        auto x = obj->queue.first(); 
-        
-        while( !id.empty() && x != nullptr ){
-            if ( x->data.first == id )
-               { return true; } 
-            else x = x->next; 
-        }
-
-        return false;
+        if( id.empty() ){ return false; }
+        return find( id, _map_::hash( id ) ) != nullptr;
     }
 
     /*─······································································─*/
 
-    void map( function_t<void,T&> callback ) const noexcept {
-         obj->queue.map( callback );
+    /* the key is handed out read only: it is what the entry is indexed
+       by, so changing it in place would make the entry unreachable */
+
+    void map( function_t<void,const U&,V&> callback ) const noexcept {
+         obj->queue.map([&]( T& item ){ callback( item.first, item.second ); });
     }
 
     /*─······································································─*/
@@ -94,7 +190,10 @@ public:
     
     ptr_t<T>   get() const noexcept { return obj->queue.data(); }
     
-    queue_t<T> raw() const noexcept { return obj->queue; }
+    /* the entries in insertion order, read only: every key is indexed,
+       so relinking or rekeying a node in place would break lookups */
+
+    const typename queue_t<T>::NODE* first() const noexcept { return obj->queue.first(); }
     
     /*─······································································─*/
 
@@ -103,10 +202,18 @@ public:
     
     /*─······································································─*/
 
-    void erase() const noexcept { obj->queue.erase(); }
+    void erase() const noexcept { 
+         obj->queue.erase(); delete [] obj->slot;
+         obj->slot = nullptr; obj->cap = 0; obj->used = 0;
+    }
 
     void erase( const U& id ) const noexcept {
-         obj->queue.erase( obj->queue.index_of([&]( T arg ){ return arg.first == id; }) );
+        if( id.empty() ){
+            obj->queue.erase( obj->queue.index_of([&]( T arg ){ return arg.first == id; }) );
+        return; }
+
+        auto hash = _map_::hash( id ); auto x = find( id, hash );
+        if( x == nullptr ){ return; } unindex( x, hash ); obj->queue.erase( x );
     }
 
 
@@ -114,4 +221,4 @@ public:
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#pragma once
+#include <time.h>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _date_ {
+
+    tm get( const bool& UTC ){ 
+        tm out; time_t now = ::time( nullptr ); 
+        if( UTC ){ gmtime_r( &now, &out ); } 
+        else     { localtime_r( &now, &out ); } return out;
+    }
+
+    string_t format( const tm& time ){
+        char res [UNBFF_SIZE]; 
+        auto size = strftime( res, UNBFF_SIZE, "%a %b %d %Y %H:%M:%S GMT%z", &time );
+        return string_t( res, size );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace date {
+
+    ullong now() {
+        timespec ts; clock_gettime( CLOCK_REALTIME, &ts );
+        return (ullong) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    }
+    
+    /*─······································································─*/
+
+    uint year( const bool& UTC=false ){ return _date_::get( UTC ).tm_year + 1900; }
+    
+    /*─······································································─*/
+
+    uint month( const bool& UTC=false ){ return _date_::get( UTC ).tm_mon; }
+    
+    /*─······································································─*/
+
+    uint day( const bool& UTC=false ){ return _date_::get( UTC ).tm_wday; }
+    
+    /*─······································································─*/
+    
+    uint hour( const bool& UTC=false ){ return _date_::get( UTC ).tm_hour; }
+    
+    /*─······································································─*/
+
+    uint minute( const bool& UTC=false ){ return _date_::get( UTC ).tm_min; }
+    
+    /*─······································································─*/
+
+    uint second( const bool& UTC=false ){ return _date_::get( UTC ).tm_sec; }
+
+    /*─······································································─*/
+
+    string_t fulltime(){ return _date_::format( _date_::get( false ) ); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class date_t {
+protected:
+
+    struct NODE {
+        bool utc;
+        uint day;
+        uint year;
+        uint hour;
+        uint month;
+        uint minute;
+        uint second;
+    };  ptr_t<NODE> obj;
+
+    tm get_time() const noexcept { tm out; memset( &out, 0, sizeof(tm) );
+        out.tm_mday = obj->day;   out.tm_year = obj->year - 1900; 
+        out.tm_hour = obj->hour;  out.tm_mon  = obj->month;
+        out.tm_min  = obj->minute;out.tm_sec  = obj->second;
+        out.tm_isdst= -1; time_t stamp = obj->utc ? timegm( &out ) : mktime( &out );
+        if( obj->utc ){ gmtime_r( &stamp, &out ); } else { localtime_r( &stamp, &out ); }
+        return out;
+    }
+    
+public:
+
+    template< class... V > 
+    date_t( const V&... args ) noexcept : obj( new NODE() ) { 
+        auto now = _date_::get( false );
+        obj->day  = now.tm_mday; obj->year   = now.tm_year + 1900;
+        obj->hour = now.tm_hour; obj->month  = now.tm_mon;
+        obj->minute=now.tm_min;  obj->second = now.tm_sec;
+        set_time( args... ); 
+    }
+    
+    /*─······································································─*/
+
+    void set_time( const bool& UTC=false ) const noexcept {
+        obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const bool& UTC=false ) const noexcept {
+        obj->year = year; obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const uint& month, const bool& UTC=false ) const noexcept { 
+        obj->month = month; obj->year = year; obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const uint& month, const uint& day, const bool& UTC=false ) const noexcept { 
+        obj->month = month; obj->year = year; obj->day = day; obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const uint& month, const uint& day, const uint& hour, const bool& UTC=false ) const noexcept { 
+        obj->month = month; obj->year = year; obj->day = day; obj->hour = hour; obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const uint& month, const uint& day, const uint& hour, const uint& min, const bool& UTC=false ) const noexcept { 
+        obj->month = month; obj->year = year; obj->day = day; obj->hour = hour; obj->minute = min; obj->utc = UTC;
+    }
+
+    void set_time( const uint& year, const uint& month, const uint& day, const uint& hour, const uint& min, const uint& second, const bool& UTC=false ) const noexcept { 
+        obj->month = month; obj->year = year; obj->day = day; obj->hour = hour; obj->minute = min; obj->second = second; obj->utc = UTC;
+    }
+    
+    /*─······································································─*/
+    
+    void set_year( uint year )   const noexcept { obj->year   = year;   }
+    void set_month( uint month ) const noexcept { obj->month  = month;  }
+    void set_second( uint sec )  const noexcept { obj->second = sec;    }
+    void set_minute( uint min )  const noexcept { obj->minute = min;    }
+    void set_hour( uint hour )   const noexcept { obj->hour   = hour;   }
+    void set_day( uint day )     const noexcept { obj->day    = day;    }
+
+    /*─······································································─*/
+
+    string_t get_fulltime() const noexcept { return _date_::format( get_time() ); }
+    
+    uint get_year()   const noexcept { return get_time().tm_year + 1900; }
+    
+    uint get_month()  const noexcept { return get_time().tm_mon;  }
+
+    uint get_hour()   const noexcept { return get_time().tm_hour; }
+    
+    uint get_day()    const noexcept { return get_time().tm_wday; }
+
+    uint get_minute() const noexcept { return get_time().tm_min;  }
+    
+    uint get_second() const noexcept { return get_time().tm_sec;  }
+
+    ulong get_stamp() const noexcept { 
+        tm time = get_time(); return (ulong)( obj->utc ? timegm( &time ) : mktime( &time ) ) * 1000;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#pragma once
+#include <cerrno>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace os {
+    
+    void exit( int err=0 ){ ::exit(err); }
+
+    /*─······································································─*/
+
+    string_t tmp(){ 
+        auto dir = ::getenv( "TMPDIR" ); 
+        return dir == nullptr ? "/tmp" : dir; 
+    }
+
+    /*─······································································─*/
+
+    uint error(){ return errno; }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
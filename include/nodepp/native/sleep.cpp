@@ -0,0 +1,58 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#pragma once
+#include <time.h>
+#include <cerrno>
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+    
+    ullong _time_ = 0;
+
+    ulong millis(){ return _time_ / 1000; }
+
+    ulong micros(){ return _time_; }
+
+    ulong seconds(){ return _time_ / 1000000; }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    ulong now(){ return millis(); }
+
+    /* reads the clock without touching the cached time, for callers
+       that may run on any thread */
+
+    ulong timestamp(){ timespec ts; clock_gettime( CLOCK_MONOTONIC, &ts );
+        return (ullong) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    }
+
+    void delay( ulong time ){ 
+        if( time == 0 ){ return; } timespec ts;
+        ts.tv_sec  = time / 1000;
+        ts.tv_nsec = time % 1000 * 1000000;
+        while( nanosleep( &ts, &ts ) == -1 && errno == EINTR ){}
+    }
+
+    void yield( ulong time=0 ){ 
+        delay( time ); _time_ = timestamp(); 
+    }
+
+    void handover(){}
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
@@ -36,10 +36,27 @@ namespace nodepp { namespace process {
 
     /*─······································································─*/
 
+#if NODEPP_MAINLOOP
+
+    void stop() = delete;
+
+    void pump(){ 
+        if( process::empty() ){ emscripten_cancel_main_loop(); return; }
+        process::yield(); ulong stamp = process::micros() + FRAME_BUDGET * 1000;
+        do { onSIGNEXT.emit(); process::next(); process::yield(); }
+        while( ( !process::task::empty() || !process::loop::empty() ) && 
+               (long)( process::micros() - stamp ) < 0 );
+        process::wake::next();
+    }
+
+#else
+
     void stop(){  while( !process::empty() ){
         onSIGNEXT.emit(); process::next();
     }}
 
+#endif
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -50,7 +67,11 @@ namespace nodepp { namespace process {
 
 namespace nodepp { namespace process {
 
-    void start(){ process::yield(); process::signal::start(); }
+    void start(){ process::yield(); process::signal::start(); 
+    #if NODEPP_MAINLOOP
+        emscripten_set_main_loop( process::pump, 0, 0 );
+    #endif
+    }
 
     void start( int argc, char** args ){
         int i=0; do {
@@ -0,0 +1,318 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_NUMBER
+#define NODEPP_NUMBER
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _number_ {
+
+    /* locale independent numeric conversions over [x,y) char ranges,
+       parse() reports 0, EINVAL or ERANGE and leaves `end` after the
+       last consumed char, format() writes into a 32 byte buffer */
+
+    const char digits[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    const ullong pow10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+
+    const double exact[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    /*─······································································─*/
+
+    inline const char* skip( const char* x, const char* y ) noexcept {
+        while( x < y && ( *x==' ' || ( *x>='\t' && *x<='\r' ) ) ){ x++; } return x;
+    }
+
+    inline bool is_digit( const char* x, const char* y ) noexcept {
+        return x < y && (uchar)( *x - '0' ) < 10;
+    }
+
+    /*─······································································─*/
+
+    template< class T >
+    int parse( const char* x, const char* y, T& out, const char*& end ) noexcept {
+        const bool sign = T(-1) < T(0); bool neg = false; out = 0; end = x;
+        const ullong max = sign ? ( 1ULL << ( sizeof(T)*8-1 ) ) - 1 : (ullong)(T)~T(0);
+
+        x = skip( x, y ); if( x < y && ( *x=='-' || *x=='+' ) ){ neg = *x++ == '-'; }
+        if( !is_digit( x, y ) ){ return EINVAL; }
+
+        /* 19 digits always fit in an ullong, only then overflow is checked */
+        ullong acc = 0; const char* z = x + 19 < y ? x + 19 : y;
+        while( x < z && (uchar)( *x - '0' ) < 10 ){ acc = acc * 10 + ( *x++ - '0' ); }
+
+        bool range = false; while( is_digit( x, y ) ){
+            ullong d = *x++ - '0';
+            if( acc > ( ~0ULL - d ) / 10 ){ range = true; } else { acc = acc * 10 + d; }
+        }   end = x;
+
+        ullong lim = sign && neg ? max + 1 : max;
+        if( !sign && neg && acc != 0 ){ return ERANGE; }
+        if( range || acc > lim ){ out = neg ? (T)( 0ULL - lim ) : (T) lim; return ERANGE; }
+        out = neg ? (T)( 0ULL - acc ) : (T) acc; return 0;
+    }
+
+    /*─······································································─*/
+
+    /* Clinger's fast path: a mantissa that fits the significand scaled by
+       an exactly representable power of ten rounds once, so it is exact;
+       anything else is handed to the C library on a copy of the token */
+
+    template< class T >
+    int parse_float( const char* x, const char* y, T& out, const char*& end,
+                     ullong limit, int range, T (*slow)( const char*, char** ) ) noexcept {
+        const char* start = x; out = 0; end = x; x = skip( x, y ); bool neg = false;
+        if( x < y && ( *x=='-' || *x=='+' ) ){ neg = *x++ == '-'; }
+
+        ullong m = 0; int n = 0, e = 0; bool dig = false, fast = true;
+        if( x+1 < y && x[0]=='0' && ( x[1]=='x' || x[1]=='X' ) ){ fast = false; }
+
+        while( is_digit( x, y ) ){ dig = true;
+            if( n < 19 ){ m = m * 10 + ( *x - '0' ); if( m ){ n++; } }
+            else        { e++; if( *x != '0' ){ fast = false; } } x++;
+        }
+
+        if( x < y && *x == '.' ){ x++; while( is_digit( x, y ) ){ dig = true;
+            if( n < 19 ){ m = m * 10 + ( *x - '0' ); if( m ){ n++; } e--; }
+            elif( *x != '0' ){ fast = false; } x++;
+        }}
+
+        if( !dig ){ fast = false; } elif( x < y && ( *x=='e' || *x=='E' ) ){
+            const char* z = x + 1; bool eneg = false; int exp = 0;
+            if( z < y && ( *z=='-' || *z=='+' ) ){ eneg = *z++ == '-'; }
+            if( is_digit( z, y ) ){ while( is_digit( z, y ) ){
+                if( exp < 100000 ){ exp = exp * 10 + ( *z - '0' ); } z++;
+            }   e += eneg ? -exp : exp; x = z; }
+        }
+
+        if( fast ){ end = x;
+            if( m == 0 ){ out = neg ? -T(0) : T(0); return 0; }
+            if( e > range && e <= range + 19 && m < limit ){
+                ullong p = pow10[ e - range ]; if( m <= limit / p ){ m *= p; e = range; }
+            }
+            if( m <= limit && e >= -range && e <= range ){
+                T v = (T) m; v = e < 0 ? v / (T) exact[-e] : v * (T) exact[e];
+                out = neg ? -v : v; return 0;
+            }
+        }
+
+        /* the copy spans the whole token, strtod never reads past it, and
+           only spills to the heap for tokens longer than the stack buffer */
+
+        while( x < y && ( (uchar)( *x - '0' ) < 10 || (uchar)( ( *x | 32 ) - 'a' ) < 26 ||
+                          *x=='.' || *x=='+' || *x=='-' ) ){ x++; }
+
+        char tmp[128]; ulong len = x - start;
+        char* buf = len < sizeof(tmp) ? tmp : (char*) ::malloc( len + 1 );
+        if( buf == nullptr ){ return ENOMEM; }
+
+        memcpy( buf, start, len ); buf[len] = '\0'; char* stop = buf;
+        int err = errno; errno = 0; out = slow( buf, &stop );
+        int res = errno == ERANGE ? ERANGE : 0; errno = err;
+        ulong off = stop - buf; if( buf != tmp ){ ::free( buf ); }
+        if( off == 0 ){ return EINVAL; } end = start + off; return res;
+    }
+
+    inline int parse( const char* x, const char* y, double& out, const char*& end ) noexcept {
+        return parse_float<double>( x, y, out, end, 1ULL << 53, 22, strtod );
+    }
+
+    inline int parse( const char* x, const char* y, float& out, const char*& end ) noexcept {
+        return parse_float<float>( x, y, out, end, 1ULL << 24, 10, strtof );
+    }
+
+    inline int parse( const char* x, const char* y, ldouble& out, const char*& end ) noexcept {
+        return parse_float<ldouble>( x, y, out, end, 0, -1, strtold );
+    }
+
+    /*─······································································─*/
+
+    inline ulong format( char* buf, ullong num ) noexcept {
+        char tmp[20]; char* x = tmp + 20; while( num >= 100 ){
+            ulong i = ( num % 100 ) * 2; num /= 100; x -= 2; memcpy( x, digits + i, 2 );
+        }
+        if( num >= 10 ){ x -= 2; memcpy( x, digits + num * 2, 2 ); }
+        else           { *--x = (char)( '0' + num ); }
+        ulong n = tmp + 20 - x; memcpy( buf, x, n ); return n;
+    }
+
+    inline ulong format( char* buf, llong num ) noexcept {
+        if( num >= 0 ){ return format( buf, (ullong) num ); } *buf = '-';
+        return format( buf + 1, 0ULL - (ullong) num ) + 1;
+    }
+
+    /*─······································································─*/
+
+    /* Grisu2 shortest round-trip digits ( Loitsch 2010 ), a 64 bit diy_fp
+       scaled by a cached power of ten narrows the rounding interval of the
+       value; the digits are cut as soon as they fall inside of it */
+
+    const ullong cached_f[] = {
+        0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL, 0xcf42894a5dce35eaULL,
+        0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL, 0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL,
+        0xbe5691ef416bd60cULL, 0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+        0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL, 0xc21094364dfb5637ULL,
+        0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL, 0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL,
+        0xb23867fb2a35b28eULL, 0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+        0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL, 0xb5b5ada8aaff80b8ULL,
+        0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL, 0x964e858c91ba2655ULL, 0xdff9772470297ebdULL,
+        0xa6dfbd9fb8e5b88fULL, 0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+        0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL, 0xaa242499697392d3ULL,
+        0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL, 0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL,
+        0x9c40000000000000ULL, 0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+        0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL, 0x9f4f2726179a2245ULL,
+        0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL, 0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL,
+        0x924d692ca61be758ULL, 0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+        0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL, 0x952ab45cfa97a0b3ULL,
+        0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL, 0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL,
+        0x88fcf317f22241e2ULL, 0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+        0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL, 0x8bab8eefb6409c1aULL,
+        0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL, 0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL,
+        0x80444b5e7aa7cf85ULL, 0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+        0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+    };
+
+    const short cached_e[] = {
+        -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,  -954,  -927,  -901,  -874,  -847,
+         -821,  -794,  -768,  -741,  -715,  -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+         -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,  -157,  -130,  -103,   -77,   -50,
+          -24,     3,    30,    56,    83,   109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+          375,   402,   428,   455,   481,   508,   534,   561,   588,   614,   641,   667,   694,   720,   747,
+          774,   800,   827,   853,   880,   907,   933,   960,   986,  1013,  1039,  1066
+    };
+
+    struct DIYFP { ullong f; int e; };
+
+    inline DIYFP mul( const DIYFP& x, const DIYFP& y ) noexcept {
+        const ullong M = 0xFFFFFFFFULL;
+        ullong a = x.f >> 32, b = x.f & M, c = y.f >> 32, d = y.f & M;
+        ullong ac = a*c, bc = b*c, ad = a*d, bd = b*d;
+        ullong t = ( bd >> 32 ) + ( ad & M ) + ( bc & M ) + ( 1ULL << 31 );
+        return { ac + ( ad >> 32 ) + ( bc >> 32 ) + ( t >> 32 ), x.e + y.e + 64 };
+    }
+
+    inline DIYFP normalize( DIYFP x ) noexcept {
+        int s = __builtin_clzll( x.f ); return { x.f << s, x.e - s };
+    }
+
+    inline void round( char* buf, int len, ullong delta, ullong rest, ullong ten, ullong wp ) noexcept {
+        while( rest < wp && delta - rest >= ten && ( rest + ten < wp || wp - rest > rest + ten - wp ) )
+             { buf[len-1]--; rest += ten; }
+    }
+
+    inline int grisu( ullong f, int e, ullong hidden, char* buf, int& K ) noexcept {
+
+        DIYFP v  = { f, e };
+        DIYFP hi = normalize({ ( f << 1 ) + 1, e - 1 });
+        DIYFP lo = f == hidden ? DIYFP{ ( f << 2 ) - 1, e - 2 } : DIYFP{ ( f << 1 ) - 1, e - 1 };
+              lo.f <<= lo.e - hi.e; lo.e = hi.e;
+
+        double dk = ( -61 - hi.e ) * 0.30102999566398114 + 347;
+        int k = (int) dk; if( dk - k > 0.0 ){ k++; }
+        int i = ( k >> 3 ) + 1; K = -( -348 + i * 8 );
+        DIYFP c = { cached_f[i], cached_e[i] };
+
+        DIYFP W  = mul( normalize( v ), c );
+        DIYFP Wp = mul( hi, c ); Wp.f--;
+        DIYFP Wm = mul( lo, c ); Wm.f++;
+
+        DIYFP one = { 1ULL << -Wp.e, Wp.e }; ullong wp = Wp.f - W.f, delta = Wp.f - Wm.f;
+        uint  p1  = (uint)( Wp.f >> -one.e ); ullong p2 = Wp.f & ( one.f - 1 );
+        int kappa = 1, len = 0; while( kappa < 10 && p1 >= pow10[kappa] ){ kappa++; }
+
+        while( kappa > 0 ){
+            uint d = p1 / pow10[kappa-1]; p1 %= pow10[kappa-1];
+            if( d || len ){ buf[len++] = (char)( '0' + d ); } kappa--;
+            ullong t = ( (ullong) p1 << -one.e ) + p2; if( t <= delta ){
+                K += kappa; round( buf, len, delta, t, pow10[kappa] << -one.e, wp ); return len;
+            }
+        }
+
+        while( true ){
+            p2 *= 10; delta *= 10; char d = (char)( p2 >> -one.e );
+            if( d || len ){ buf[len++] = (char)( '0' + d ); }
+            p2 &= one.f - 1; kappa--; if( p2 < delta ){ K += kappa;
+                round( buf, len, delta, p2, one.f, -kappa < 20 ? wp * pow10[-kappa] : 0 ); return len;
+            }
+        }
+
+    }
+
+    /*─······································································─*/
+
+    inline ulong exponent( char* buf, int K ) noexcept {
+        char* x = buf; *x++ = 'e'; *x++ = K < 0 ? '-' : '+'; if( K < 0 ){ K = -K; }
+        return format( x, (ullong) K ) + 2;
+    }
+
+    inline ulong pretty( char* buf, int len, int k ) noexcept {
+        int kk = len + k; /* 10^(kk-1) <= v < 10^kk */
+
+        if( k >= 0 && kk <= 21 ){
+            for( int i=len; i<kk; i++ ){ buf[i] = '0'; }
+            buf[kk] = '.'; buf[kk+1] = '0'; return kk + 2;
+        } elif( kk > 0 && kk <= 21 ){
+            memmove( buf + kk + 1, buf + kk, len - kk ); buf[kk] = '.'; return len + 1;
+        } elif( kk > -6 && kk <= 0 ){
+            int off = 2 - kk; memmove( buf + off, buf, len );
+            buf[0] = '0'; buf[1] = '.'; for( int i=2; i<off; i++ ){ buf[i] = '0'; }
+            return len + off;
+        } elif( len == 1 ){
+            return 1 + exponent( buf + 1, kk - 1 );
+        } else {
+            memmove( buf + 2, buf + 1, len - 1 ); buf[1] = '.';
+            return len + 1 + exponent( buf + len + 1, kk - 1 );
+        }
+    }
+
+    inline ulong format( char* buf, ullong f, int e, ullong hidden, bool neg, bool special ) noexcept {
+        char* x = buf; if( special ){
+            if( f != hidden ){ memcpy( x, "nan", 3 ); return 3; }
+            if( neg ){ *x++ = '-'; } memcpy( x, "inf", 3 ); return x - buf + 3;
+        }
+        if( neg ){ *x++ = '-'; } if( f == 0 ){ memcpy( x, "0.0", 3 ); return x - buf + 3; }
+        int K = 0, len = grisu( f, e, hidden, x, K );
+        return x - buf + pretty( x, len, K );
+    }
+
+    inline ulong format( char* buf, double num ) noexcept {
+        ullong b; memcpy( &b, &num, sizeof(b) ); int be = ( b >> 52 ) & 0x7FF;
+        ullong f = b & ( ( 1ULL << 52 ) - 1 ), h = 1ULL << 52;
+        if( be == 0x7FF ){ return format( buf, f + h, 0, h, b >> 63, true ); }
+        return be ? format( buf, f + h, be - 1075, h, b >> 63, false )
+                  : format( buf, f    ,     -1074, h, b >> 63, false );
+    }
+
+    inline ulong format( char* buf, float num ) noexcept {
+        uint b; memcpy( &b, &num, sizeof(b) ); int be = ( b >> 23 ) & 0xFF;
+        ullong f = b & ( ( 1U << 23 ) - 1 ), h = 1ULL << 23;
+        if( be == 0xFF ){ return format( buf, f + h, 0, h, b >> 31, true ); }
+        return be ? format( buf, f + h, be - 150, h, b >> 31, false )
+                  : format( buf, f    ,     -149, h, b >> 31, false );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
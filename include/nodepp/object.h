@@ -67,7 +67,7 @@ private:
 
     using T     = type::pair<string_t,object_t>;
     using ARRAY = array_t<object_t>;
-    using QUEUE = queue_t<T>;
+    using MAP   = map_t<string_t,object_t>;
 
 protected: 
 
@@ -76,24 +76,42 @@ protected:
         int   type =0;
     };  ptr_t<NODE> obj;
 
+    /*─······································································─*/
+
+    /* operator[] has to hand back something that can be assigned to, so a
+       missing key is added with no value. Nothing drops it behind the
+       caller's back, which would leave that reference dangling: size()
+       counts it, while keys(), copy() and json::stringify skip it */
+
+    MAP members() const noexcept {
+        if( !has_value() || obj->type != 20  )
+          { obj->mem=MAP(); obj->type= 20; }
+        return obj->mem.as<MAP>();
+    }
+
+    template< class U >
+    object_t clone() const noexcept { return obj->mem.as<U>(); }
+
 public:
 
     template< ulong N > 
-    object_t( const T (&arr) [N] ) noexcept : obj(new NODE()) { 
-        QUEUE mem; for( ulong x=0; x<N; x++ )
-            { mem.push( arr[x] ); }
+    object_t( const T (&arr) [N] ) noexcept : obj( ptr_t<NODE>::make() ) { 
+        MAP mem; for( ulong x=0; x<N; x++ )
+            { mem[ arr[x].first ] = arr[x].second; }
         obj->mem = mem; obj->type = 20;
     }
 
     template< class U > 
-    object_t( const U& any ) noexcept : obj(new NODE()) { 
+    object_t( const U& any ) noexcept : obj( ptr_t<NODE>::make() ) { 
         if( type::is_same<U,ARRAY>::value )
           { obj->type = 21; goto BACK; }  
+        if( type::is_same<U,MAP>::value )
+          { obj->type = 20; goto BACK; }  
         obj->type = obj_type_id<U>::value;
         BACK:; obj->mem  = any;
     }
     
-    object_t() noexcept : obj( new NODE() ) {}
+    object_t() noexcept : obj( ptr_t<NODE>::make() ) {}
 
     /*─······································································─*/
 
@@ -115,37 +133,12 @@ public:
     /*─······································································─*/
 
     object_t& operator[]( const string_t& name ) const noexcept {
-        if( !has_value() || obj->type != 20  )
-          { obj->mem=QUEUE(); obj->type= 20; }
-
-        auto mem = type::cast<QUEUE>(obj->mem);
-        auto x   = mem.first();
-
-        while( x != nullptr ){ auto y = x->next;
-           if( x->data.first == string::to_string(name) )
-             { return x->data.second; }
-           if(!x->data.second.has_value() )
-             { mem.erase(x); } x = y;
-        }
-
-        T item ({ name, object_t() }); mem.push( item ); 
-        obj->mem = mem; obj->type = 20;
-        return mem.last()->data.second;
+        auto mem = members(); return mem[name];
     }
 
     bool has( const string_t& name ) const noexcept {
-        if( !has_value() || obj->type != 20  )
-          { obj->mem=QUEUE(); obj->type= 20; }
-
-        auto mem = type::cast<QUEUE>(obj->mem);
-        auto x   = mem.first();
-
-        while( x != nullptr ){
-           if( x->data.first == string::to_string(name) )
-             { return true; } x = x->next;
-        }
-
-        return false;
+        if( obj->type != 20 ){ return false; } auto mem = obj->mem.as<MAP>(); 
+        if( !mem.has(name) ){ return false; } return mem[name].has_value();
     }
 
     /*─······································································─*/
@@ -168,9 +161,10 @@ public:
     /*─······································································─*/
 
     array_t<string_t> keys() const noexcept { array_t<string_t> res;
-        if( obj->type == 20 ){ auto mem = obj->mem.as<QUEUE>();
-            mem.map([&]( T item ){ res.push( item.first ); });
-        }   return res;
+        if( obj->type != 20 ){ return res; } auto x = obj->mem.as<MAP>().first();
+        while( x != nullptr ){
+           if( x->data.second.has_value() ){ res.push( x->data.first ); } x = x->next;
+        }  return res;
     }
 
     int get_type_id() const noexcept { return obj->type; }
@@ -182,7 +176,7 @@ public:
             auto   mem = obj->mem.as<ARRAY>();
             return mem.empty();
         } elif( obj->type == 20 ) {
-            auto   mem = obj->mem.as<QUEUE>();
+            auto   mem = obj->mem.as<MAP>();
             return mem.empty();
         }   return false;
     }
@@ -194,7 +188,7 @@ public:
             auto   mem = obj->mem.as<ARRAY>();
             return mem.size();
         } elif( obj->type == 20 ) {
-            auto   mem = obj->mem.as<QUEUE>();
+            auto   mem = obj->mem.as<MAP>();
             return mem.size();
         }   return 0;
     }
@@ -202,20 +196,30 @@ public:
     /*─······································································─*/
 
     void erase( const string_t& name ) const noexcept {
-        if( !has_value() || obj->type != 20  )
-          { obj->mem=QUEUE(); obj->type= 20; }
+        auto mem = members(); mem.erase( name );
+    }
 
-        auto mem = obj->mem.as<QUEUE>();
-        auto x   = mem.first();
+    void erase() noexcept { obj = ptr_t<NODE>::make(); }
 
-        while( x != nullptr ) { auto y = x->next;
-           if( x->data.first == string::to_string(name) )
-             { mem.erase( x ); } x = y;
-        } 
-        
-    }
+    /*─······································································─*/
 
-    void erase() noexcept { obj = new NODE(); }
+    object_t copy() const noexcept {
+        if( !has_value() ){ return object_t(); } switch( obj->type ){
+            case 20: { MAP out; auto x = obj->mem.as<MAP>().first(); while( x != nullptr ){
+                       if( x->data.second.has_value() ){ out[ x->data.first.copy() ] = x->data.second.copy(); } 
+                       x = x->next; }   return out; }
+            case 21: { ARRAY out; for( auto& x : obj->mem.as<ARRAY>() )
+                       { out.push( x.copy() ); } return out; }
+            case 18: return obj->mem.as<string_t>().copy();
+            case  1: return clone<int>();      case  2: return clone<uint>();
+            case  3: return clone<bool>();     case  4: return clone<char>();
+            case  5: return clone<long>();     case  6: return clone<short>();
+            case  7: return clone<uchar>();    case  8: return clone<llong>();
+            case  9: return clone<ulong>();    case 10: return clone<ushort>();
+            case 11: return clone<ullong>();   case 15: return clone<float>();
+            case 16: return clone<double>();   case 17: return clone<ldouble>();
+        }   return *this;
+    }
     
 };}
 
@@ -58,12 +58,10 @@ public: observer_t() noexcept {} queue_t<T> node;
     
     /*─······································································─*/
 
-    void off( void* address ) const noexcept { 
-        if( !address ){ return; } *((int*)address) = -1; 
-    }
+    void off( const handle_t& address ) const noexcept { process::clear( address ); }
 
     template< class F >
-    void* once( const U& name, F func ) const noexcept {
+    handle_t once( const U& name, F func ) const noexcept {
         auto n = node.first(); while( n!=nullptr ){
         if ( n->data.first == name ){
              return n->data.third.once( func );
@@ -71,7 +69,7 @@ public: observer_t() noexcept {} queue_t<T> node;
     }
 
     template< class F >
-    void* on( const U& name, F func ) const noexcept {
+    handle_t on( const U& name, F func ) const noexcept {
         auto n = node.first(); while( n!=nullptr ){
         if ( n->data.first == name ){
              return n->data.third.on( func );
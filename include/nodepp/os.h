@@ -14,7 +14,11 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "wasm/os.cpp"
+#if _KERNEL == NODEPP_KERNEL_WASM
+    #include "wasm/os.cpp"
+#else
+    #include "native/os.cpp"
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -14,47 +14,67 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "generator.h"
 #include "expected.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { namespace promise {
 
-    template< class T, class V > void* resolve( 
+    template< class T, class V > handle_t resolve( 
         function_t<void,function_t<void,T>,function_t<void,V>> func,
         function_t<void,T> res, function_t<void,V> rej
-    ){  
-        ptr_t<bool> state = new bool(1); _promise_::resolve task;
-        return process::task::add( task, state, func, [=]( T data ){
-           if( *state != 1 ){ return; } res(data); *state = 0;
-        }, [=]( V data ) {
-           if( *state != 1 ){ return; } rej(data); *state = 0;
+    ){  _arena_::heap_t heap;
+        ptr_t<_handle_::flag_t> out = new _handle_::flag_t();
+        function_t<void,T> _res ([=]( T data ){
+           if( !out->alive() ){ return; } out->close(); 
+           process::micro::add([=](){ res( data ); });
+        });
+        function_t<void,V> _rej ([=]( V data ){
+           if( !out->alive() ){ return; } out->close(); 
+           process::micro::add([=](){ rej( data ); });
         });
+        process::micro::add([=](){ 
+           if( out->alive() ){ func( _res, _rej ); }
+        }); return out->hdl;
     }
 
     /*─······································································─*/
 
-    template< class T > void* resolve( 
+    template< class T > handle_t resolve( 
         function_t<void,function_t<void,T>> func,
         function_t<void,T> res
-    ){  
-        ptr_t<bool> state = new bool(1); _promise_::resolve task;
-        return process::task::add( task, state, func, [=]( T data ){
-           if( *state != 1 ){ return; } res(data); *state = 0;
+    ){  _arena_::heap_t heap;
+        ptr_t<_handle_::flag_t> out = new _handle_::flag_t();
+        function_t<void,T> _res ([=]( T data ){
+           if( !out->alive() ){ return; } out->close(); 
+           process::micro::add([=](){ res( data ); });
         });
+        process::micro::add([=](){ 
+           if( out->alive() ){ func( _res ); }
+        }); return out->hdl;
     }
 
     /*─······································································─*/
 
+#if NODEPP_MAINLOOP
+
+    template< class T > T await( 
+        function_t<void,function_t<void,T>> func 
+    ) = delete;
+
+    template< class T, class V > expected_t<T,V> await( 
+        function_t<void,function_t<void,T>,function_t<void,V>> func 
+    ) = delete;
+
+#else
+
     template< class T > T await( 
         function_t<void,function_t<void,T>> func 
     ){  
         ptr_t<bool> state = new bool(1); T result; 
-        _promise_::resolve task;
-        process::await( task, state, func, [&]( T data ){
+        func([&]( T data ){
             if( *state != 1 ){ return; } result = data; *state = 0;
-        }); return result;
+        }); while( *state==1 ){ process::next(); } return result;
     }
 
     /*─······································································─*/
@@ -63,17 +83,19 @@ namespace nodepp { namespace promise {
         function_t<void,function_t<void,T>,function_t<void,V>> func 
     ){   
         ptr_t<bool> state = new bool(1); T res; V rej; bool x=0;
-        _promise_::resolve task;
-        process::await( task, state, func, [&]( T data ){
+        func([&]( T data ){
             if( *state != 1 ){ return; } res = data; *state = 0; x=1;
         }, [&]( V data ){
             if( *state != 1 ){ return; } rej = data; *state = 0; x=0;
-        }); if( x ){ return res; } return rej;
+        }); while( *state==1 ){ process::next(); }
+        if( x ){ return res; } return rej;
     }
+
+#endif
     
     /*─······································································─*/
 
-    void clear( void* address ){ process::clear( address ); }
+    void clear( const handle_t& address ){ process::clear( address ); }
 
 }}
 
@@ -84,7 +106,7 @@ protected:
 
     struct NODE {
         function_t<void,function_t<void,T>,function_t<void,V>> main_func;
-        void* addr = nullptr; uchar state = 0;
+        handle_t addr; uchar state = 0;
     };  ptr_t<NODE> obj;
 
     event_t<T> onDone; 
@@ -103,10 +125,10 @@ public:
     void resolve() const noexcept { 
         if( obj->state==0 ){ return; } 
         if( obj->state!=2 ){ return; } 
-        obj->state=0; auto self = type::bind(this);
+        obj->state=0; auto done = onDone; auto fail = onFail;
         obj->addr = promise::resolve<T,V>( obj->main_func, 
-            [=]( T res ){ self->onDone.emit( res ); },
-            [=]( V rej ){ self->onFail.emit( rej ); }
+            [=]( T res ){ _trace_::span_t span( "promise", "resolve" ); done.emit( res ); },
+            [=]( V rej ){ _trace_::span_t span( "promise", "reject"  ); fail.emit( rej ); }
         ); 
     }
 
@@ -14,7 +14,7 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-namespace nodepp { template< class T > class ptr_t { 
+namespace nodepp { template< class T, bool A=false > class ptr_t { 
 public:
     
     ptr_t( ulong n, const T& value ) noexcept { resize( n, value ); }
@@ -29,6 +29,13 @@ public:
 
     ptr_t( ptr_t&& other ) noexcept { mve( type::move(other) ); }
     ptr_t( const ptr_t& other ) noexcept { cpy(other); }
+
+    template< class U >
+    ptr_t( const ptr_t<U,A>& other ) noexcept { 
+        if( other.count() == 0 ){ return; }
+        ctrl_  = (CTRL*) other.ctrl_;
+        value_ = other.value_; inc( ctrl_->count );
+    }
     
     /*─······································································─*/
 
@@ -96,9 +103,9 @@ public:
 
     ptr_t copy() const noexcept {
           if( count() > 0 && size() == 0 )
-            { return new T( *value_ ); }
+            { return make( *value_ ); }
         elif( count() > 0 && size() > 0 ){
-            auto n_buffer = ptr_t<T>( size() );
+            auto n_buffer = ptr_t( size() );
             memcpy( &n_buffer, value_, size() );
             return n_buffer;
         }   return nullptr;
@@ -108,28 +115,27 @@ public:
 
     void resize( ulong n, const T& c ) noexcept { reset(); 
         if( n == 0 ){ 
-            length_= new ulong( 0 ); 
-            count_ = new ulong( 1 );
-            value_ = new T(c); return; 
-        } else {
-            length_= new ulong( n ); 
-            count_ = new ulong( 1 );
-            value_ = new T[n];
-        }   while( n-->0 ) value_[n] = c;
+            alloc( 1, 0 ); new ( value_ ) T( c ); return;
+        }   alloc( n, n ); 
+        for( ulong x=0; x<n; x++ ){ new ( value_ + x ) T( c ); }
     }
 
     void resize( T* c, ulong n ) noexcept { reset();
         if( c == nullptr ){ return; }
-        length_= new ulong( n ); 
-        count_ = new ulong( 1 );
+        ctrl_  = new CTRL(); ctrl_->length = n;
         value_ = c;
     }
     
     void resize( ulong n ) noexcept { reset(); 
-        if( n == 0 ){ return; }
-        length_= new ulong( n ); 
-        count_ = new ulong( 1 );
-	    value_ = new T[n];
+        if( n == 0 ){ return; } alloc( n, n );
+        for( ulong x=0; x<n; x++ ){ new ( value_ + x ) T; }
+    }
+    
+    /*─······································································─*/
+
+    template< class... V >
+    static ptr_t make( const V&... args ) noexcept {
+        ptr_t out; out.alloc( 1, 0 ); new ( out.value_ ) T( args... ); return out;
     }
     
     /*─······································································─*/
@@ -138,24 +144,28 @@ public:
         if( value_ == nullptr ){ return; }
 
         if( count() != 0 )      {
-        if( --(*count_) == 0 )  {
-            if(*length_ == 0 )  {
+        if( dec( ctrl_->count ) == 0 ){
+            if( !ctrl_->inl )   {
+            if( ctrl_->length == 0 ){
                      delete    value_;
             } else { delete [] value_; }
-                     delete    count_;
-                     delete   length_;
+            } else { 
+                ulong n = ctrl_->length == 0 ? 1 : ctrl_->length;
+                while( n-->0 ){ value_[n].~T(); }
+            }        drop( ctrl_ );
         }}
 
-        length_= nullptr;
-        count_ = nullptr;
+        ctrl_  = nullptr;
         value_ = nullptr;
     }
 
     /*─······································································─*/
 
     bool has_value() const noexcept { return !null() && count()!= 0; }
-    ulong     size() const noexcept { return  null() ? 0 : *length_; }
-    ulong    count() const noexcept { return  null() ? 0 : *count_;  }
+    ulong     size() const noexcept { return  null() ? 0 : ctrl_->length; }
+    ulong    count() const noexcept { return  null() ? 0 : A ?
+                                       __atomic_load_n( &ctrl_->count, __ATOMIC_ACQUIRE ) :
+                                       ctrl_->count;  }
     bool     empty() const noexcept { return  null() || size()==0 ;  }
     bool      null() const noexcept { return  value_ == nullptr; }
     T*        data() const noexcept { return  value_; }
@@ -165,7 +175,7 @@ public:
 
     T*    end() const noexcept { return value_ + size(); }
     T*  begin() const noexcept { return value_; }
-    void free() const noexcept { *count_ = 0; }
+    void free() const noexcept { ctrl_->count = 0; }
     
     /*─······································································─*/
 
@@ -180,28 +190,78 @@ public:
 
 protected:
 
-    ulong* length_= nullptr;
-    ulong* count_ = nullptr;
-        T* value_ = nullptr;
+    /* count and length live in one header; owned storage is laid out
+       right after it in the same block, adopted pointers keep their own.
+       A picks the counting policy at compile time: plain by default,
+       atomic for atomic_ptr_t, so single threaded code pays nothing.
+       weak counts weak_ptr_t holders plus one for all strong ones, the
+       value dies with the last strong ref and the block with the last weak.
+       Blocks taken from an active arena_t are marked arn and never freed
+       here, the arena hands them back all at once */
+
+    template< class, bool > friend class weak_ptr_t;
+    template< class, bool > friend class ptr_t;
+
+    struct CTRL {
+        ulong count  = 1;
+        ulong weak   = 1;
+        ulong length = 0;
+        bool  inl    = 0;
+        bool  arn    = 0;
+    };
+
+    CTRL* ctrl_  = nullptr;
+       T* value_ = nullptr;
+    
+    /*─······································································─*/
+
+    void alloc( ulong n, ulong length ) noexcept {
+        ulong off = ( sizeof(CTRL) + alignof(T) - 1 ) / alignof(T) * alignof(T);
+        bool  arn = 0; auto mem = (char*) _arena_::alloc( off + n * sizeof(T), arn );
+        ctrl_  = new ( mem ) CTRL(); ctrl_->length = length; ctrl_->inl = 1; ctrl_->arn = arn;
+        value_ = (T*)( mem + off );
+    }
+    
+    /*─······································································─*/
+
+    static void inc( ulong& n ) noexcept {
+        if( !A ){ ++n; return; }
+        __atomic_add_fetch( &n, 1, __ATOMIC_RELAXED );
+    }
+
+    static ulong dec( ulong& n ) noexcept {
+        if( !A ){ return --n; }
+        return __atomic_sub_fetch( &n, 1, __ATOMIC_ACQ_REL );
+    }
+
+    static bool grab( ulong& n ) noexcept {
+        if( !A ){ if( n == 0 ){ return 0; } ++n; return 1; }
+        ulong x = __atomic_load_n( &n, __ATOMIC_RELAXED ); while( x != 0 ){
+        if( __atomic_compare_exchange_n( &n, &x, x+1, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED ) )
+          { return 1; }
+        }   return 0;
+    }
+
+    static void drop( CTRL* ctrl ) noexcept {
+        if( dec( ctrl->weak ) != 0 || ctrl->arn ){ return; }
+        if( !ctrl->inl ){ delete ctrl; } else { ::operator delete( (void*) ctrl ); }
+    }
     
     /*─······································································─*/
 
     void cpy( const ptr_t& other ) noexcept {
         if( other.count() == 0 ){ return; }
-        length_= other.length_;
-        count_ = other.count_;
-        value_ = other.value_; ++(*count_);
+        ctrl_  = other.ctrl_;
+        value_ = other.value_; inc( ctrl_->count );
     }
     
     /*─······································································─*/
 
     void mve( ptr_t&& other ) noexcept {
         if( other.count() == 0 ){ return; }
-        length_ = other.length_;
-        count_  = other.count_;
-        value_  = other.value_;
-        other.length_= nullptr;
-        other.count_ = nullptr;
+        ctrl_  = other.ctrl_;
+        value_ = other.value_;
+        other.ctrl_  = nullptr;
         other.value_ = nullptr;
     }
 
@@ -209,4 +269,81 @@ protected:
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { template< class T > using atomic_ptr_t = ptr_t<T,true>; }
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { template< class T, bool A=false > class weak_ptr_t { 
+protected:
+
+    using PTR  = ptr_t<T,A>;
+    using CTRL = typename PTR::CTRL;
+
+    CTRL* ctrl_  = nullptr;
+       T* value_ = nullptr;
+
+    void cpy( CTRL* ctrl, T* value ) noexcept {
+        if( ctrl == nullptr ){ return; } PTR::inc( ctrl->weak );
+        ctrl_ = ctrl; value_ = value;
+    }
+
+public:
+
+    weak_ptr_t( const PTR& other ) noexcept { cpy( other.ctrl_, other.value_ ); }
+    weak_ptr_t()                   noexcept {}
+
+   ~weak_ptr_t() noexcept { reset(); }
+    
+    /*─······································································─*/
+
+    weak_ptr_t( const weak_ptr_t& other ) noexcept { cpy( other.ctrl_, other.value_ ); }
+
+    weak_ptr_t( weak_ptr_t&& other ) noexcept : ctrl_( other.ctrl_ ), value_( other.value_ ) {
+        other.ctrl_ = nullptr; other.value_ = nullptr;
+    }
+    
+    /*─······································································─*/
+
+    weak_ptr_t& operator=( const weak_ptr_t& other ) noexcept {
+        if( this != &other ){ reset(); cpy( other.ctrl_, other.value_ ); }
+        return *this;
+    }
+
+    weak_ptr_t& operator=( weak_ptr_t&& other ) noexcept {
+        if( this != &other ){ reset(); 
+            ctrl_ = other.ctrl_; other.ctrl_  = nullptr;
+           value_ = other.value_;other.value_ = nullptr;
+        }   return *this;
+    }
+
+    weak_ptr_t& operator=( const PTR& other ) noexcept {
+        reset(); cpy( other.ctrl_, other.value_ ); return *this;
+    }
+    
+    /*─······································································─*/
+
+    void reset() noexcept {
+        if( ctrl_ != nullptr ){ PTR::drop( ctrl_ ); }
+        ctrl_ = nullptr; value_ = nullptr;
+    }
+
+    /*─······································································─*/
+
+    ulong  count() const noexcept { return ctrl_ == nullptr ? 0 : A ?
+                                    __atomic_load_n( &ctrl_->count, __ATOMIC_ACQUIRE ) :
+                                    ctrl_->count; }
+    bool expired() const noexcept { return count() == 0; }
+    bool    null() const noexcept { return ctrl_ == nullptr; }
+    
+    /*─······································································─*/
+
+    PTR lock() const noexcept { PTR out;
+        if( ctrl_ == nullptr || !PTR::grab( ctrl_->count ) ){ return out; }
+        out.ctrl_ = ctrl_; out.value_ = value_; return out;
+    }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 #endif
\ No newline at end of file
@@ -16,13 +16,51 @@
 
 namespace nodepp {
 template< class V > class queue_t {
-protected: 
+protected: struct DONE; public:
+
+    /* nodes carry their owner so membership checks are O(1), and freed
+       nodes are recycled through a per-type, per-thread freelist that
+       keeps at most QUEUE_POOL of them and is drained when the thread
+       exits; while an arena_t is active they come from it, are flagged
+       arn, and are never recycled, so freeing one never has to search
+       the arenas */
 
     class NODE { public:
         NODE* next = nullptr;
-        NODE* prev = nullptr; V data; 
+        NODE* prev = nullptr;
+        DONE* own  = nullptr; V data; bool arn = 0;
         NODE( V value ){ data = value; } 
+
+        static NODE* make( const V& value ) noexcept { bool flag = 0; void* addr;
+            if( _arena_::act != nullptr ){ addr = _arena_::alloc( sizeof(NODE), flag ); }
+          elif( pool == nullptr )        { addr = ::operator new( sizeof(NODE) ); }
+          else { addr = pool; pool = *((void**) addr ); size--; }
+            auto out = new ( addr ) NODE( value ); out->arn = flag; return out;
+        }
+
+        static void kill( NODE* x ) noexcept {
+            bool flag = x->arn; x->~NODE(); if( flag ){ return; }
+            if( size >= QUEUE_POOL ){ ::operator delete( (void*) x ); return; }
+            if( !armed ){ armed = 1; (void) &drain; }
+            *((void**) x ) = pool; pool = (void*) x; size++;
+        }
+
+    private:
+
+        /* the list itself is plain thread_local data, so taking a node
+           stays a load and a store; drain is only touched once, when the
+           first node is pooled, and empties the list at thread exit, then
+           leaves it full so nodes freed after that go back to the heap */
+
+        struct DRAIN { ~DRAIN() noexcept { size = QUEUE_POOL; while( pool != nullptr ){
+            void* x = pool; pool = *((void**) x ); ::operator delete( x );
+        }}};
+
+        static thread_local void* pool; static thread_local ulong size;
+        static thread_local bool armed; static thread_local DRAIN drain;
     };
+
+protected:
     
     struct DONE {
         NODE *fst    = nullptr;
@@ -62,17 +100,17 @@ protected:
 public:
 
     template < class T, ulong N >
-    queue_t( const T (&value)[N] ) noexcept : obj( new DONE ) { 
+    queue_t( const T (&value)[N] ) noexcept : obj( ptr_t<DONE>::make() ) { 
         auto i=N; while( i-->0 ){ unshift(value[i]); }
     }
 
     template < class T >
-    queue_t( const T* value, ulong N ) noexcept : obj( new DONE ) { 
+    queue_t( const T* value, ulong N ) noexcept : obj( ptr_t<DONE>::make() ) { 
         if( value == nullptr || N == 0 ){ return; }
         auto i=N; while( i-->0 ){ unshift(value[i]); }
     }
     
-    queue_t() noexcept : obj( new DONE ) {}
+    queue_t() noexcept : obj( ptr_t<DONE>::make() ) {}
     
     /*─······································································─*/
 
@@ -86,8 +124,7 @@ public:
                  { n = n->next; continue; } break;
             }
 
-            V item; memcpy( &item, &x->data, sizeof(V) );
-            n_buffer.insert( n, item ); x = x->next;
+            n_buffer.insert( n, x->data ); x = x->next;
         }
 
         return n_buffer;
@@ -169,11 +206,7 @@ public:
     /*─······································································─*/
     
     bool is_item( NODE* item ) const noexcept {
-        if( item == nullptr ){ return false; }
-        auto n = first(); while( n!=nullptr ){
-         if( n == item ){ return true; } 
-             n = n->next;
-        }    return false;
+        return item != nullptr && item->own == &obj;
     }
 
     /*─······································································─*/
@@ -210,19 +243,14 @@ public:
     }
 
     void insert( NODE* n, const V& value ) noexcept {
-        if( empty() ){
-            obj->fst = new NODE( value ); obj->lst = first();
+        auto m = NODE::make( value ); m->own = &obj; if( empty() ){
+            obj->fst = m; obj->lst = m;
         } elif ( is_item(n) ) {
-            auto  m = new NODE( value ); m->prev = n->prev; 
-            if ( n->prev!= nullptr ){ n->prev->next = m; }
-            if ( n->next== nullptr ){ obj->lst = n; }
-            if ( m->prev== nullptr ){ obj->fst = m; }
-                 m->next = n; n->prev = m;
+            m->prev = n->prev; m->next = n;
+            if ( n->prev!= nullptr ){ n->prev->next = m; } else { obj->fst = m; }
+                 n->prev = m;
         } else { 
-            auto n = last(); auto m = new NODE( value ); 
-            if ( n->prev== nullptr ){ obj->fst = n; }
-            if ( m->next== nullptr ){ obj->lst = m; }
-                 m->prev = n; n->next = m;
+            auto n = last(); m->prev = n; n->next = m; obj->lst = m;
         }   obj->length += 1;
     }
     
@@ -248,7 +276,7 @@ public:
         if( n == obj->act ){ next(); } do {
             if ( n->prev != nullptr ){ n->prev->next = n->next; }
             if ( n->next != nullptr ){ n->next->prev = n->prev; } 
-        } while(0); delete n; obj->length -= 1;
+        } while(0); n->own = nullptr; NODE::kill( n ); obj->length -= 1;
     }
 
     /*─······································································─*/
@@ -270,7 +298,14 @@ public:
     NODE* first() const noexcept { return obj->fst == nullptr ? nullptr : obj->fst; }
     NODE* last()  const noexcept { return obj->lst == nullptr ? first() : obj->lst; }
 
-};}
+};
+
+template< class V > thread_local void* queue_t<V>::NODE::pool  = nullptr;
+template< class V > thread_local ulong queue_t<V>::NODE::size  = 0;
+template< class V > thread_local bool  queue_t<V>::NODE::armed = 0;
+template< class V > thread_local typename queue_t<V>::NODE::DRAIN queue_t<V>::NODE::drain;
+
+}
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -14,7 +14,11 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "wasm/sleep.cpp"
+#if _KERNEL == NODEPP_KERNEL_WASM
+    #include "wasm/sleep.cpp"
+#else
+    #include "native/sleep.cpp"
+#endif
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
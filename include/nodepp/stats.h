@@ -0,0 +1,76 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_STATS_API
+#define NODEPP_STATS_API
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#include "json.h"
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _stats_ {
+
+    object_t queue( ulong size, const QUEUE& q ){
+        object_t out;
+        out["depth"] = size;
+        out["peak"]  = q.peak;
+        out["runs"]  = q.runs;
+        return out;
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process {
+
+    object_t stats(){ object_t out, tick, time;
+        auto& x = _stats_::data;
+
+        tick["count"] = x.ticks;
+        tick["p50"]   = _stats_::percentile( 50 );
+        tick["p99"]   = _stats_::percentile( 99 );
+        tick["max"]   = x.tick_max;
+
+        time["busy"]  = x.busy;
+        time["idle"]  = x.idle;
+
+        out["enabled"]  = (bool) NODEPP_STATS;
+        out["task"]     = _stats_::queue( process::task::size(), process::task::_stat_ );
+        out["loop"]     = _stats_::queue( process::loop::size(), process::loop::_stat_ );
+        out["poll"]     = _stats_::queue( process::poll::size(), process::poll::_stat_ );
+        out["wake"]     = process::wake::size();
+        out["threads"]  = (long) __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE );
+        out["runs"]     = x.runs;
+        out["rate"]     = x.rate;
+        out["task_max"] = x.task_max;
+        out["tick"]     = tick;
+        out["time"]     = time;
+
+        return out;
+    }
+
+    /*─······································································─*/
+
+    void reset_stats(){ 
+        process::task::_stat_ = _stats_::QUEUE();
+        process::loop::_stat_ = _stats_::QUEUE();
+        process::poll::_stat_ = _stats_::QUEUE();
+        _stats_::data = _stats_::NODE();
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
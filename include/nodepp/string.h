@@ -14,6 +14,115 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#if   defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _string_ {
+
+    /* first/last byte filter: a block of W candidates is tested at once by
+       comparing the first needle byte at p and the last one at p+n-1, only
+       the surviving positions pay for a memcmp */
+
+#if   defined(__AVX2__)
+
+    const ulong W = 32;
+
+    inline uint mask( const char* a, const char* b, char x, char y ) noexcept {
+        __m256i u = _mm256_cmpeq_epi8( _mm256_loadu_si256((const __m256i*) a ), _mm256_set1_epi8( x ) );
+        __m256i v = _mm256_cmpeq_epi8( _mm256_loadu_si256((const __m256i*) b ), _mm256_set1_epi8( y ) );
+        return (uint) _mm256_movemask_epi8( _mm256_and_si256( u, v ) );
+    }
+
+#elif defined(__SSE2__)
+
+    const ulong W = 16;
+
+    inline uint mask( const char* a, const char* b, char x, char y ) noexcept {
+        __m128i u = _mm_cmpeq_epi8( _mm_loadu_si128((const __m128i*) a ), _mm_set1_epi8( x ) );
+        __m128i v = _mm_cmpeq_epi8( _mm_loadu_si128((const __m128i*) b ), _mm_set1_epi8( y ) );
+        return (uint) _mm_movemask_epi8( _mm_and_si128( u, v ) );
+    }
+
+#elif defined(__wasm_simd128__)
+
+    const ulong W = 16;
+
+    inline uint mask( const char* a, const char* b, char x, char y ) noexcept {
+        v128_t u = wasm_i8x16_eq( wasm_v128_load( a ), wasm_i8x16_splat( x ) );
+        v128_t v = wasm_i8x16_eq( wasm_v128_load( b ), wasm_i8x16_splat( y ) );
+        return (uint) wasm_i8x16_bitmask( wasm_v128_and( u, v ) );
+    }
+
+#else
+
+    const ulong W = 0;
+
+    inline uint mask( const char*, const char*, char, char ) noexcept { return 0; }
+
+#endif
+
+    /*─······································································─*/
+
+    inline const char* find( const char* data, ulong size, char ch ) noexcept {
+#if   defined(__wasm_simd128__)
+        ulong x=0; for( ; x+W <= size; x+=W ){
+            uint m = mask( data+x, data+x, ch, ch );
+            if ( m != 0 ){ return data + x + __builtin_ctz( m ); }
+        }   for( ; x<size; x++ ){ if( data[x] == ch ){ return data + x; } }
+        return nullptr;
+#else
+        return (const char*) memchr( data, ch, size );
+#endif
+    }
+
+    inline const char* find( const char* data, ulong size, const char* key, ulong n ) noexcept {
+        if( n == 0 || n > size ){ return nullptr; }
+        if( n == 1 ){ return find( data, size, key[0] ); }
+
+        ulong end = size - n + 1, x = 0;
+
+        if( W > 0 ){ for( ; x+W <= end; x+=W ){
+            uint m = mask( data+x, data+x+n-1, key[0], key[n-1] ); while( m != 0 ){
+                ulong y = x + __builtin_ctz( m ); m &= m - 1;
+                if( memcmp( data+y+1, key+1, n-2 ) == 0 ){ return data + y; }
+        }}}
+
+        while( x < end ){
+            auto y = find( data+x, end-x, key[0] ); if( y == nullptr ){ return nullptr; }
+            if ( y[n-1] == key[n-1] && memcmp( y+1, key+1, n-2 ) == 0 ){ return y; }
+            x  = y - data + 1;
+        }   return nullptr;
+    }
+
+    /*─······································································─*/
+
+    /* whether any pointer among a format's arguments points into [a,b),
+       so format_to can tell when growing the string would pull the bytes
+       out from under snprintf */
+
+    inline bool inside( const char*, const char* ) noexcept { return false; }
+
+    template< class V, class... T >
+    bool inside( const char* a, const char* b, const V&, const T&... args ) noexcept {
+        return inside( a, b, args... );
+    }
+
+    template< class V, class... T >
+    bool inside( const char* a, const char* b, V* const& x, const T&... args ) noexcept {
+        return ( (const char*) x >= a && (const char*) x < b ) || inside( a, b, args... );
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace nodepp {
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -70,10 +179,60 @@ namespace string {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+class string_view_t; class string_t; namespace string {
+    template< class... T > string_t format( const char* str, const T&... args );
+    template< class... T > ulong format_to( string_t& out, const char* str, const T&... args );
+}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 class string_t {
-protected: 
+protected: friend class string_view_t;
+
+    template< class... T > 
+    friend ulong string::format_to( string_t& out, const char* str, const T&... args );
     
-    ptr_t<char> buffer;
+    /* up to STRING_SSO bytes live in local and are copied along with the
+       string_t, so short strings behave as values: writing through one
+       copy is not seen by the others. Longer ones live in buffer, which
+       copies share until one of them has to grow or shrink it */
+
+    ptr_t<char> buffer; ulong length = 0; char local[ STRING_SSO+1 ] = {0};
+
+    char* addr() const noexcept { return buffer.null() ? (char*) local : &buffer; }
+
+    void grow( ulong n ) noexcept {
+        if( buffer.null() ){ if( n <= STRING_SSO ){ return; }
+            auto n_buffer = string::buffer( max( n, capacity() * 2 ) );
+            memcpy( &n_buffer, local, length ); buffer = n_buffer; return;
+        }   if( buffer.count() == 1 && n <= capacity() ){ return; }
+        if( n <= STRING_SSO ){ 
+            memcpy( local, &buffer, length ); local[length] = '\0'; 
+            buffer.reset(); return; 
+        }   auto n_buffer = string::buffer( n > capacity() ? max( n, capacity() * 2 ) : capacity() );
+        if( length > 0 ){ memcpy( &n_buffer, &buffer, length ); } buffer = n_buffer;
+    }
+
+    void fit() noexcept {
+        length = buffer.size() <= 1 ? 0 : buffer.size() - 1;
+    }
+
+    void share( const string_t& oth ) noexcept {
+        buffer = oth.buffer; length = oth.length; if( !buffer.null() )
+          { local[0] = '\0'; return; } memcpy( local, oth.local, length + 1 );
+    }
+
+    void take( string_t& oth ) noexcept {
+        buffer = type::move( oth.buffer ); length = oth.length;
+        memcpy( local, oth.local, length <= STRING_SSO ? length + 1 : 1 );
+        oth.length = 0; oth.local[0] = '\0';
+    }
+
+    void assign( const char* argc, ulong n ) noexcept {
+        if( argc == nullptr || n == 0 ){ return; } if( n > STRING_SSO )
+          { buffer = string::buffer( argc, n ); fit(); return; }
+        memcpy( local, argc, n ); local[n] = '\0'; length = n;
+    }
 
     ptr_t<ulong> get_slice_range( long x, long y ) const noexcept {
         
@@ -107,47 +266,75 @@ public:
 
     string_t() noexcept { buffer = nullptr; }
 
+    string_t( const string_t& oth ) noexcept { share( oth ); }
+
+    string_t( string_t&& oth ) noexcept { take( oth ); }
+
+    string_t& operator=( const string_t& oth ) noexcept {
+        if( this != &oth ){ share( oth ); } return *this;
+    }
+
+    string_t& operator=( string_t&& oth ) noexcept {
+        if( this != &oth ){ take( oth ); } return *this;
+    }
+
     string_t( const char* argc ) noexcept {
         if( argc == nullptr ){ 
             buffer = nullptr; return;
-        }   buffer = string::buffer( argc, strlen(argc) );
+        }   assign( argc, strlen(argc) );
     }
 
     string_t( const ulong& n, const char& c ) noexcept {
         if( n == 0 ){ 
             buffer = nullptr; return;
-        }   buffer = string::buffer( n, c );
+        }   insert( 0, n, c );
     }
 
     string_t( const char* argc, const ulong& n ) noexcept {
         if( argc == nullptr || n == 0 ){ 
             buffer = nullptr; return;
-        }   buffer = string::buffer( argc, n );
+        }   assign( argc, n );
     }
     
     /*─······································································─*/
 
-    string_t( const ptr_t<char>& argc ) noexcept { buffer = argc; }
+    string_t( const ptr_t<char>& argc ) noexcept { buffer = argc; fit(); }
 
     /*─······································································─*/
 
-    char*   end() const noexcept { return &buffer + size(); }
-    char* begin() const noexcept { return &buffer; }
+    char*   end() const noexcept { return addr() + size(); }
+    char* begin() const noexcept { return addr(); }
     
     /*─······································································─*/
 
-    ulong first() const noexcept { return 0; }
-    bool  empty() const noexcept { return buffer.size() <= 1; }
-    ulong  size() const noexcept { return empty() ? 0 : buffer.size() - 1; }
-    ulong  last() const noexcept { return empty() ? 0 : buffer.size() - 2; }
+    ulong    first() const noexcept { return 0; }
+    bool     empty() const noexcept { return length == 0; }
+    ulong     size() const noexcept { return length; }
+    ulong     last() const noexcept { return empty() ? 0 : length - 1; }
+    ulong capacity() const noexcept { 
+        if( buffer.null() ){ return STRING_SSO; }
+        return buffer.size() <= 1 ? 0 : buffer.size() - 1; 
+    }
+    
+    /*─······································································─*/
+
+    void reserve( ulong n ) noexcept { if( n > capacity() ){ grow( n ); } }
+
+    void shrink_to_fit() noexcept {
+        if( buffer.null() || buffer.count() > 1 || capacity() == length ){ return; } 
+        if( length <= STRING_SSO ){ 
+            memcpy( local, &buffer, length ); local[length] = '\0';
+            buffer.reset(); return; 
+        }
+        buffer = string::buffer( &buffer, length );
+    }
     
     /*─······································································─*/
 
     string_t operator+=( const string_t& oth ){ 
-        if( oth.empty() ){ return *this; } string_t ths = copy(); ulong n = 0;
-        buffer = string::buffer( this->size() + oth.size() );
-        for( auto x : ths ){ (*this)[n] = x; n++; }
-        for( auto x : oth ){ (*this)[n] = x; n++; } return *this;
+        if( oth.empty() ){ return *this; } ulong n = oth.size();
+        grow( length + n ); memmove( addr() + length, oth.get(), n );
+        length += n; addr()[length] = '\0'; return *this;
     }
     
     /*─······································································─*/
@@ -159,7 +346,7 @@ public:
     bool operator==( const string_t& oth ) const noexcept { return compare( oth ) == 0; }
     bool operator!=( const string_t& oth ) const noexcept { return compare( oth ) != 0; }
     
-    char& operator[]( ulong n ) const noexcept { return buffer[n]; }
+    char& operator[]( ulong n ) const noexcept { return addr()[ n <= length ? n : n % ( length + 1 ) ]; }
     
     /*─······································································─*/
 
@@ -197,20 +384,17 @@ public:
     /*─······································································─*/
 
     ptr_t<int> find( const string_t& data, ulong offset=0 ) const noexcept {
-        if ( data.empty() ){ return nullptr; }
-        ulong x=0; int n=0; ptr_t<int> pos ({ 0, 0 });
-        for( ulong i=offset; i<buffer.size(); i++ ){ 
-            if ( buffer[i] == data[x] ){
-                pos[n]=i; x++; n=1;
-            } elif ( x==data.size() ){ 
-                pos[n]=i; x++; n=1; break; 
-            } else { n=0; x=0; }
-        }
-        return !x ? nullptr : pos;
+        if( offset >= size() ){ return nullptr; }
+        auto x = _string_::find( addr()+offset, size()-offset, data.addr(), data.size() );
+        if( x == nullptr ){ return nullptr; } int y = x - addr();
+        return ptr_t<int>({ y, y + (int) data.size() });
     }
 
     ptr_t<int> find( const char& data, ulong offset=0 ) const noexcept {
-        return find( string_t( 1UL, data ), offset );
+        if( offset >= size() ){ return nullptr; }
+        auto x = _string_::find( addr()+offset, size()-offset, data );
+        if( x == nullptr ){ return nullptr; } int y = x - addr();
+        return ptr_t<int>({ y, y + 1 });
     }
     
     /*─······································································─*/
@@ -238,14 +422,14 @@ public:
         for( auto& x : *this ){ if(func(x)) x=targ; } return (*this); 
     }
 
-    string_t copy() const noexcept { return buffer.copy(); }
+    string_t copy() const noexcept { return string_t( addr(), length ); }
 
     /*─······································································─*/
 
-    void fill( const char& argc ) const noexcept { buffer.fill(argc); }
+    void fill( const char& argc ) const noexcept { memset( addr(), argc, length ); }
 
     template< class... T >
-    void resize( T... args ) noexcept { buffer.resize(args...); }
+    void resize( T... args ) noexcept { buffer.resize(args...); fit(); }
     
     /*─······································································─*/
 
@@ -253,7 +437,7 @@ public:
         queue_t<char> n_buffer;
 
         for( ulong i=0; i<size(); i++ ){
-            auto x = buffer[i]; auto n = n_buffer.first();
+            auto x = addr()[i]; auto n = n_buffer.first();
             while( n!=nullptr ){ 
                if( !func( x, n->data ) )
                  { n = n->next; continue; } break;
@@ -272,77 +456,50 @@ public:
     
     /*─······································································─*/
 
-    void clear() noexcept { buffer.reset(); }
-    void erase() noexcept { buffer.reset(); }
-    void  free() noexcept { buffer.reset(); }
+    void clear() noexcept { buffer.reset(); length = 0; local[0] = '\0'; }
+    void erase() noexcept { buffer.reset(); length = 0; local[0] = '\0'; }
+    void  free() noexcept { buffer.reset(); length = 0; local[0] = '\0'; }
     
     /*─······································································─*/
 
     void insert( ulong index, const char& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( 1 ); buffer[0] = value; } 
-        else { ulong n=size() + 1; auto n_buffer = string::buffer(n); 
-            for( ulong x=0,i=0; x<n; x++ ){ 
-                if( x == index ){ n_buffer[x] = value; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+        insert( index, 1UL, value );
     }
 
     void insert( ulong index, ulong N , char* value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( value, N ); } 
-        else { ulong n=size() + N; auto n_buffer = string::buffer(n); 
-            for( ulong x=0,i=0,p=0; x<n; x++ ){ 
-                if( x>=index && x<index+N ){ n_buffer[x] = value[p++]; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N == 0 || value == nullptr ){ return; }
+        if( value >= addr() && value < addr() + capacity() )
+          { insert( index, string_t( value, N ) ); return; }
+        grow( length + N ); auto data = addr();
+        memmove( data + index + N, data + index, length - index );
+        memcpy ( data + index, value, N ); length += N; data[length] = '\0';
     }
 
     void insert( ulong index, ulong N , const char& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( N, value ); } 
-        else { ulong n=size() + N; auto n_buffer = string::buffer(n); 
-            for( ulong x=0,i=0; x<n; x++ ){ 
-                if( x>=index && x<index+N ){ n_buffer[x] = value; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+	    index = clamp( index, 0UL, size() ); if( N == 0 ){ return; }
+        char item = value; grow( length + N ); auto data = addr();
+        memmove( data + index + N, data + index, length - index );
+        memset ( data + index, item, N ); length += N; data[length] = '\0';
     }
 
     void insert( ulong index, const string_t& value ) noexcept {
-	    index = clamp( index, 0UL, size() );
-        if( empty() ){ buffer = string::buffer( value.size() ); 
-            for( ulong i=0; i<value.size(); i++ ){ buffer[i] = value[i]; }
-        } else { ulong n=size() + value.size(); auto n_buffer = string::buffer(n); 
-            for( ulong x=0,i=0,p=0; x<n; x++ ){ 
-                if( x>=index && x<index+value.size() ){ n_buffer[x] = value[p++]; }
-                else { n_buffer[x] = buffer[i++]; }
-            }   buffer = n_buffer;
-        }
+        if( value.empty() ){ return; } if( value.addr() == addr() || ( !buffer.null() && value.buffer.get() == buffer.get() ) )
+          { insert( index, value.copy() ); return; }
+        insert( index, value.size(), value.get() );
     }
     
     /*─······································································─*/
 
     void erase( ulong index ) noexcept {
 	    auto r = get_slice_range( index, size() );
-         if( r == nullptr ){ return; } else {
-            auto n_buffer = string::buffer( size() - 1 );
-            for( ulong i=0, j=0; i<size(); i++ ){ if( i != r[0] )
-               { n_buffer[j] = buffer[i]; j++; }
-            }    buffer = n_buffer;
-        }
+         if( r == nullptr ){ return; } erase( r[0], r[0] + 1 );
     }
 
     void erase( ulong start, ulong end  ) noexcept {
 	    auto r = get_slice_range( start, end );
-         if( r == nullptr ){ return; } else {
-            auto n_buffer = string::buffer( size() - (r[1]-r[0]) - 1 );
-            for( ulong i=0, j=0; i<=last(); i++ ){ if( i<r[0] || i>r[1] )
-               { n_buffer[j] = buffer[i]; j++; }
-            }    buffer = n_buffer;
-        }
+         if( r == nullptr ){ return; } grow( length ); auto data = addr();
+        memmove( data + r[0], data + r[1] + 1, length - r[1] - 1 );
+        length -= r[2]; data[length] = '\0';
     }
     
     /*─······································································─*/
@@ -352,7 +509,7 @@ public:
         auto r = get_slice_range( start, size() );
          if( r == nullptr ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( addr()+r[0], r[2] );
         return n_buffer;
     }
     
@@ -363,7 +520,7 @@ public:
         auto r = get_slice_range( start, end );
          if( r == nullptr ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( addr()+r[0], r[2] );
         return n_buffer;
     }
     
@@ -374,7 +531,7 @@ public:
         auto r = get_splice_range( start, end );
          if( r == nullptr ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( addr()+r[0], r[2] );
         erase( r[0], r[0]+end ); return n_buffer;
     }
 
@@ -384,7 +541,7 @@ public:
         auto r = get_splice_range( start, end );
          if( r == nullptr ){ return nullptr; }
 
-        auto n_buffer = string_t( buffer.data()+r[0], r[2] );
+        auto n_buffer = string_t( addr()+r[0], r[2] );
         erase( r[0], r[0]+end ); insert( r[0], value ); return n_buffer;
     }
     
@@ -392,7 +549,7 @@ public:
 
     string_t to_capital_case() const noexcept { 
         if ( empty() ){ return nullptr; } bool b=1; ptr_t<char> res (size()+1,0);
-        for( ulong x=0; x<res.size(); x++ ){ auto y = buffer[x];
+        for( ulong x=0; x<res.size(); x++ ){ auto y = addr()[x];
             if( string::is_alpha(y) && b==1 ){ res[x] = string::to_upper(y); b=0; continue; }
             if(!string::is_alpha(y) ){ b =1;}  res[x] = string::to_lower(y);
         }   return res;
@@ -401,20 +558,20 @@ public:
     string_t to_lower_case() const noexcept {
         if ( empty() ){ return nullptr; } ptr_t<char> res (size()+1,0);
         for( ulong x=0; x<res.size(); x++ ){
-             res[x] = string::to_lower( buffer[x] );
+             res[x] = string::to_lower( addr()[x] );
         }    return res;
     }
 
     string_t to_upper_case() const noexcept { 
         if ( empty() ){ return nullptr; } ptr_t<char> res (size()+1,0);
         for( ulong x=0; x<res.size(); x++ ){
-             res[x] = string::to_upper( buffer[x] );
+             res[x] = string::to_upper( addr()[x] );
         }    return res;
     }
 
     string_t to_slugify() const noexcept { ulong z=0;
         if ( empty() ){ return nullptr; } ptr_t<char> res (size()+1,0);
-        for( ulong x=0; x<res.size(); x++ ){ auto y = buffer[x];
+        for( ulong x=0; x<res.size(); x++ ){ auto y = addr()[x];
               if ( !string::is_alnum(y) ) { continue; }
             else { res[z] = string::to_lower(y); z++; }
         }   return { &res, z };
@@ -422,21 +579,24 @@ public:
 
     /*─······································································─*/
 
-    explicit operator char* (void) const noexcept { return empty() ? (char*)"" : &buffer; }
-          char*  data() const noexcept { return empty() ? (char*) "" : &buffer; }
-          char*   get() const noexcept { return empty() ? (char*) "" : &buffer; }
-    const char* c_str() const noexcept { return empty() ?         "" : &buffer; }
+    explicit operator char* (void) const noexcept { return empty() ? (char*)"" : addr(); }
+          char*  data() const noexcept { return empty() ? (char*) "" : addr(); }
+          char*   get() const noexcept { return empty() ? (char*) "" : addr(); }
+    const char* c_str() const noexcept { return empty() ?         "" : addr(); }
     explicit operator bool(void) const noexcept { return empty(); }
-    ptr_t<char>&  ptr() noexcept { return buffer; }
+    ptr_t<char>&  ptr() noexcept { 
+          if( buffer.null() ){ buffer = string::buffer( local, length ); }
+        elif( buffer.count() == 1 && capacity() != length ){ buffer = string::buffer( &buffer, length ); }
+        return buffer; 
+    }
     
 };
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 string_t operator+( const string_t& A, const string_t& B ){
-    string_t C = string::buffer( A.size() + B.size() ); ulong n = 0;
-    for( auto x : A ){ C[n] = x; n++; }
-    for( auto x : B ){ C[n] = x; n++; } return C;
+    string_t C; C.reserve( A.size() + B.size() );
+    C += A; C += B; return C;
 }
 
 string_t operator^( const string_t& A, const string_t& B ){
@@ -456,28 +616,28 @@ void operator^=( string_t& A, const string_t& B ){
 namespace string {
 
     int to_int( const string_t& buffer ){ 
-        int out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%d", &out ); return out;
+        int out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     bool to_bool( const string_t& buffer ){ 
-        int out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%d", &out ); return out;
+        int out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     ldouble to_ldouble( const string_t& buffer ){
-        ldouble out=0.0f; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%Lf", &out ); return out;
+        ldouble out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     double to_double( const string_t& buffer ){
-        double out=0.0f; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%lf", &out ); return out;
+        double out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     float to_float( const string_t& buffer ){
-        float out=0.0f; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%f", &out ); return out;
+        float out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     char to_char( const string_t& buffer ){ 
@@ -486,8 +646,8 @@ namespace string {
     }
 
     uint to_uint( const string_t& buffer ){
-        uint out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%u", &out ); return out;
+        uint out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     void* to_addr( const string_t& buffer ){
@@ -501,32 +661,68 @@ namespace string {
     }
 
     long to_long( const string_t& buffer ){
-        long out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%ld", &out ); return out;
+        long out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     llong to_llong( const string_t& buffer ){
-        llong out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%lld", &out ); return out;
+        llong out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
 
     ulong to_ulong( const string_t& buffer ){
-        ulong out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%lu", &out ); return out;
+        ulong out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
     }
 
     ullong to_ullong( const string_t& buffer ){
-        ullong out=0; if( buffer.empty() ){ return out; }
-        sscanf( (char*) buffer, "%llu", &out ); return out;
+        ullong out=0; if( buffer.empty() ){ return out; } const char* end;
+        _number_::parse( buffer.begin(), buffer.end(), out, end ); return out;
+    }
+    
+    /*─······································································─*/
+
+    template< class T >
+    int to_number( const string_t& buffer, T& out ){ const char* end;
+        int err = _number_::parse( buffer.begin(), buffer.end(), out, end );
+        if( err == 0 && end != buffer.end() ){ out = 0; return EINVAL; } return err;
     }
     
     /*─······································································─*/
 
+    /* formats straight into the spare room at the end of out, which is
+       first grown to fit twice the format's length; when the result still
+       does not fit, that first call has measured it, so out grows once
+       and the format is written again in place. Growing may free out's
+       bytes, so a format or argument that points into them is formatted
+       into a fresh string and appended instead */
+
+    template< class... T >
+    ulong format_to( string_t& out, const char* str, const T&... args ){
+        auto a = out.addr(), b = a + out.capacity() + 1;
+        if( _string_::inside( a, b, str, args... ) ){
+            string_t tmp = format( str, args... ); out += tmp; return tmp.size();
+        }   out.grow( out.length + 2 * strlen( str ) ); ulong room = out.capacity() - out.length + 1;
+        int n = snprintf( out.addr() + out.length, room, str, args... );
+        if( n <= 0 ){ out.addr()[ out.length ] = '\0'; return 0; } if( (ulong) n >= room ){ 
+            out.grow( out.length + n ); snprintf( out.addr() + out.length, n+1, str, args... );
+        }   out.length += n; return n;
+    }
+
+    template< class... T >
+    ulong format_to( string_t& out, const string_t& str, const T&... args ){
+        return format_to( out, str.get(), args... );
+    }
+
+    template< class... T >
+    string_t format( const char* str, const T&... args ){
+        string_t out; format_to( out, str, args... ); return out;
+    }
+
     template< class... T >
     string_t format( const string_t& str, const T&... args ){
-        char   buffer[UNBFF_SIZE]; sprintf( buffer, (char*)str, args... ); 
-        return buffer;
+        string_t out; format_to( out, str.get(), args... ); return out;
     }
 
     template< class... T >
@@ -548,18 +744,18 @@ namespace string {
     }
 
     string_t to_string( uint num ){
-        char buffer[32]; auto x = sprintf( buffer, "%u", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, (ullong) num );
+        return { buffer, x };
     }
 
     string_t to_string( int num ){
-        char buffer[32]; auto x = sprintf( buffer, "%d", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, (llong) num );
+        return { buffer, x };
     }
 
     string_t to_string( long num ){
-        char buffer[32]; auto x = sprintf( buffer, "%ld", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, (llong) num );
+        return { buffer, x };
     }
 
     string_t to_string( wchar num ){
@@ -568,23 +764,23 @@ namespace string {
     }
 
     string_t to_string( ulong num ){
-        char buffer[32]; auto x = sprintf( buffer, "%lu", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, (ullong) num );
+        return { buffer, x };
     }
 
     string_t to_string( llong num ){
-        char buffer[32]; auto x = sprintf( buffer, "%lld", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, num );
+        return { buffer, x };
     }
 
     string_t to_string( ullong num ){
-        char buffer[32]; auto x = sprintf( buffer, "%llu", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, num );
+        return { buffer, x };
     }
 
     string_t to_string( double num ){
-        char buffer[32]; auto x = sprintf( buffer, "%lf", num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, num );
+        return { buffer, x };
     }
 
     string_t to_string( ldouble num ){
@@ -603,8 +799,8 @@ namespace string {
     }
 
     string_t to_string( float num ){
-        char buffer[32]; auto x = sprintf( buffer, "%lf", (double)num );
-        return { buffer, (ulong)x };
+        char buffer[32]; auto x = _number_::format( buffer, num );
+        return { buffer, x };
     }
 
 }
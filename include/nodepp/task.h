@@ -14,11 +14,204 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace nodepp { namespace _task_ {
+
+    class BASE { public:
+        virtual ~BASE() noexcept {}
+        virtual int run() = 0;
+    };
+
+    /*─······································································─*/
+
+    template< class F > class IMPL : public BASE { 
+    public: 
+
+        IMPL( const F& fn ) noexcept : fn( fn ) {}
+        virtual int run() { return fn(); }
+
+        static void* operator new( ulong size ) noexcept {
+            if( pool == nullptr ){ return ::operator new( size ); }
+            auto x = pool; pool = *((void**) x); return x;
+        }
+
+        static void operator delete( void* addr ) noexcept {
+            *((void**) addr ) = pool; pool = addr;
+        }
+
+    private: 
+        static void* pool; F fn;
+    };
+
+    template< class F > void* IMPL<F>::pool = nullptr;
+
+    /*─······································································─*/
+
+    class list_t; struct TASK {
+        TASK*    next = nullptr;
+        TASK*    prev = nullptr;
+        list_t*  own  = nullptr;
+        BASE*    cb   = nullptr;
+        handle_t hdl;
+        bool     blk  = 0;
+        bool     out  = 1;
+    };  TASK* pool = nullptr;
+
+    /*─······································································─*/
+
+    class list_t {
+    protected:
+
+        TASK* fst = nullptr;
+        TASK* lst = nullptr;
+        TASK* act = nullptr;
+        ulong length = 0;
+
+        TASK* alloc() noexcept {
+            if( pool == nullptr ){ return new TASK(); }
+            auto x = pool; pool = x->next; 
+            x->next = nullptr; x->blk = 0; x->out = 1; return x;
+        }
+
+        void erase( TASK* x ) noexcept {
+            if( x == act )          { act = x->next; }
+            if( x->prev != nullptr ){ x->prev->next = x->next; } else { fst = x->next; }
+            if( x->next != nullptr ){ x->next->prev = x->prev; } else { lst = x->prev; }
+            delete x->cb; x->cb = nullptr; x->prev = nullptr; 
+            _handle_::release( x->hdl ); x->hdl = nullptr;
+            x->next = pool; pool = x; length--;
+        }
+
+        static void kill( void* addr ) noexcept {
+            auto x = (TASK*) addr; x->out = 0; if( x->blk ){ return; }
+            x->own->erase( x );
+        }
+
+    public:
+
+        ulong size() const noexcept { return length; }
+        bool empty() const noexcept { return length == 0; }
+
+        /*─······································································─*/
+
+        template< class F >
+        handle_t push( const F& fn ) noexcept {
+            auto x = alloc(); x->cb = new IMPL<F>( fn ); x->own = this;
+            x->prev = lst; if( lst != nullptr ){ lst->next = x; } else { fst = x; }
+            lst = x; length++; return x->hdl = _handle_::alloc( x, &kill );
+        }
+
+        void clear() noexcept { 
+            auto x = fst; while( x != nullptr ){ auto y = x->next; 
+                x->out = 0; if( !x->blk ){ erase(x); } 
+            x = y; }
+        }
+
+        /*─······································································─*/
+
+        bool next() noexcept {
+            auto x = act == nullptr ? fst : act; 
+            if( x == nullptr ){ return 0; } act = x;
+            if( x->blk )       { act = x->next; return act != nullptr; }
+            if( x->out == 0 )  { erase(x); return act != nullptr; }
+            x->blk = 1; int y = x->cb->run(); x->blk = 0;
+              if( y ==-1 || x->out == 0 ){ erase(x); }
+            elif( y == 1 ){ act = x->next; }
+            return act != nullptr;
+        }
+
+    };
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _stats_ {
+
+    struct QUEUE {
+        ulong runs = 0;
+        ulong peak = 0;
+    };
+
+    struct NODE {
+        ulong  hist[32] = { 0 };
+        ulong  ticks = 0, tick_max = 0, task_max = 0;
+        ullong busy  = 0, idle = 0;
+        ulong  runs  = 0, rate = 0, last = 0;
+        ulong  win_runs = 0, win_stamp = 0;
+    };  NODE data;
+
+    /*─······································································─*/
+
+#if NODEPP_STATS
+
+    void depth( QUEUE& q, ulong size ){ if( size > q.peak ){ q.peak = size; } }
+
+    void tick(){ ulong now = process::micros();
+        if( data.last == 0 ){ data.last = data.win_stamp = now; return; }
+        ulong time = now - data.last, b = 0; data.last = now;
+        data.ticks++; data.busy += time; if( time > data.tick_max ){ data.tick_max = time; }
+        while( b < 31 && ( time >> b ) > 1 ){ b++; } data.hist[b]++;
+        if( now - data.win_stamp < 1000000 ){ return; }
+        data.rate = ( data.runs - data.win_runs ) * 1000000ULL / ( now - data.win_stamp );
+        data.win_runs = data.runs; data.win_stamp = now;
+    }
+
+    void idle( ulong time ){ data.idle += time; data.last = process::micros(); }
+
+#else
+
+    void depth( QUEUE&, ulong ){}
+
+    void tick(){}
+
+    void idle( ulong ){}
+
+#endif
+
+    /*─······································································─*/
+
+#if NODEPP_STATS > 1
+
+    ulong stamp(){ return process::micros(); }
+
+    ulong run( QUEUE& q, ulong stamp ){ q.runs++; data.runs++;
+        process::yield(); ulong now = process::micros(), time = now - stamp;
+        if( time > data.task_max ){ data.task_max = time; } return now;
+    }
+
+#elif NODEPP_STATS
+
+    ulong stamp(){ return 0; }
+
+    ulong run( QUEUE& q, ulong ){ q.runs++; data.runs++; return 0; }
+
+#else
+
+    ulong stamp(){ return 0; }
+
+    ulong run( QUEUE&, ulong ){ return 0; }
+
+#endif
+
+    /*─······································································─*/
+
+    ulong percentile( ulong p ){
+        ulong n = ( data.ticks * p + 99 ) / 100, acc = 0;
+        if( n == 0 ){ return 0; } for( ulong b=0; b<32; b++ ){
+            acc += data.hist[b]; if( acc < n ){ continue; }
+            return min( ( 2UL << b ) - 1, data.tick_max );
+        }   return data.tick_max;
+    }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace nodepp { namespace process {
 
-namespace task {
+namespace micro {
 
-    queue_t<function_t<int>> queue;
+    _task_::list_t queue;
 
     void clear(){ queue.clear(); }
 
@@ -26,31 +219,51 @@ namespace task {
 
     bool empty(){ return queue.empty(); }
 
-    void clear( void* address ){ 
-        if( address == nullptr ){ return; }
-            *((bool*)( address )) = 0; 
+    void clear( const handle_t& address ){ _handle_::clear( address ); }
+
+    template< class T, class... V >
+    handle_t add( T cb, const V&... arg ){ _arena_::heap_t heap;
+        return queue.push([=]() mutable { cb( arg... ); return -1; });
+    }
+
+    void drain(){ 
+        if( queue.empty() ){ return; } _trace_::span_t span( "process", "micro" );
+        while( queue.next() ){}
     }
 
+}
+
+    /*─······································································─*/
+
+namespace task {
+
+    _task_::list_t queue; _stats_::QUEUE _stat_; ulong _count_=1, _limit_=0;
+
+    void budget( ulong count, ulong time=0 ){ _count_=max( count, 1UL ); _limit_=time; }
+
+    void clear(){ queue.clear(); }
+
+    ulong size(){ return queue.size(); }
+
+    bool empty(){ return queue.empty(); }
+
+    void clear( const handle_t& address ){ _handle_::clear( address ); }
+
     template< class T, class... V >
-    void* add( T cb, const V&... arg ){ 
+    handle_t add( T cb, const V&... arg ){ _arena_::heap_t heap;
         if( queue.size() >= MAX_TASKS ){ return nullptr; }
-        ptr_t<T>    clb = new T( cb );
-        ptr_t<bool> blk = new bool(0);
-        ptr_t<bool> out = new bool(1); queue.push([=](){ 
-            if( *out==0 ){ return -1; }
-            if( *blk==1 ){ return  1; } *blk = 1;
-            int rs = (*clb) (arg...);   *blk = 0; 
-            return *out==0 ? -1 : rs; 
-        }); return (void*) &out;
+        return queue.push([=]() mutable { return cb( arg... ); });
     }
 
-    bool next(){
-        if( queue.empty() ){ return 0; }
-          auto x = queue.get();
-          int  y = x->data();
-        if( y ==-1 ){ queue.erase(x); }
-        if( y == 1 ){ queue.next();   }
-        return queue.get()!=queue.last();
+    bool next(){ return queue.next(); }
+
+    ulong drain(){ ulong n=0, stamp=0; _trace_::span_t span( "process", "task" );
+        if( _limit_ != 0 ){ process::yield(); stamp = process::micros() + _limit_; }
+        _stats_::depth( _stat_, queue.size() ); ulong t = _stats_::stamp();
+        while( n < _count_ && !queue.empty() ){ next(); process::micro::drain(); n++; t = _stats_::run( _stat_, t );
+            if( _limit_ == 0 ){ continue; } process::yield();
+            if( (long)( process::micros() - stamp ) >= 0 ){ break; }
+        }   return n;
     }
 
 }
@@ -59,7 +272,9 @@ namespace task {
 
 namespace loop {
 
-    queue_t<function_t<int>> queue;
+    _task_::list_t queue; _stats_::QUEUE _stat_; ulong _count_=1, _limit_=0;
+
+    void budget( ulong count, ulong time=0 ){ _count_=max( count, 1UL ); _limit_=time; }
 
     void clear(){ queue.clear(); }
 
@@ -67,31 +282,23 @@ namespace loop {
 
     bool empty(){ return queue.empty(); }
 
-    void clear( void* address ){ 
-        if( address == nullptr ){ return; }
-            *((bool*)( address )) = 0; 
-    }
+    void clear( const handle_t& address ){ _handle_::clear( address ); }
 
     template< class T, class... V >
-    void* add( T cb, const V&... arg ){ 
+    handle_t add( T cb, const V&... arg ){ _arena_::heap_t heap;
         if( queue.size() >= MAX_TASKS ){ return nullptr; }
-        ptr_t<T>    clb = new T( cb );
-        ptr_t<bool> blk = new bool(0);
-        ptr_t<bool> out = new bool(1); queue.push([=](){ 
-            if( *out==0 ){ return -1; }
-            if( *blk==1 ){ return  1; } *blk = 1;
-            int rs = (*clb) (arg...);   *blk = 0; 
-            return *out==0 ? -1 : rs; 
-        }); return (void*) &out;
+        return queue.push([=]() mutable { return cb( arg... ); });
     }
 
-    bool next(){
-        if( queue.empty() ){ return 0; }
-          auto x = queue.get();
-          int  y = x->data();
-        if( y ==-1 ){ queue.erase(x); }
-        if( y == 1 ){ queue.next();   }
-        return queue.get()!=queue.last();
+    bool next(){ return queue.next(); }
+
+    ulong drain(){ ulong n=0, stamp=0; _trace_::span_t span( "process", "loop" );
+        if( _limit_ != 0 ){ process::yield(); stamp = process::micros() + _limit_; }
+        _stats_::depth( _stat_, queue.size() ); ulong t = _stats_::stamp();
+        while( n < _count_ && !queue.empty() ){ next(); process::micro::drain(); n++; t = _stats_::run( _stat_, t );
+            if( _limit_ == 0 ){ continue; } process::yield();
+            if( (long)( process::micros() - stamp ) >= 0 ){ break; }
+        }   return n;
     }
 
 }
@@ -100,7 +307,9 @@ namespace loop {
 
 namespace poll {
 
-    queue_t<function_t<int>> queue;
+    _task_::list_t queue; _stats_::QUEUE _stat_; ulong _count_=1, _limit_=0;
+
+    void budget( ulong count, ulong time=0 ){ _count_=max( count, 1UL ); _limit_=time; }
 
     void clear(){ queue.clear(); }
 
@@ -108,31 +317,55 @@ namespace poll {
 
     bool empty(){ return queue.empty(); }
 
-    void clear( void* address ){ 
-        if( address == nullptr ){ return; }
-            *((bool*)( address )) = 0; 
-    }
+    void clear( const handle_t& address ){ _handle_::clear( address ); }
 
     template< class T, class... V >
-    void* add( T cb, const V&... arg ){ 
+    handle_t add( T cb, const V&... arg ){ _arena_::heap_t heap;
         if( queue.size() >= MAX_FILENO ){ return nullptr; }
-        ptr_t<T>    clb = new T( cb );
-        ptr_t<bool> blk = new bool(0);
-        ptr_t<bool> out = new bool(1); queue.push([=](){ 
-            if( *out==0 ){ return -1; }
-            if( *blk==1 ){ return  1; } *blk = 1;
-            int rs = (*clb) (arg...);   *blk = 0; 
-            return *out==0 ? -1 : rs; 
-        }); return (void*) &out;
+        return queue.push([=]() mutable { return cb( arg... ); });
+    }
+
+    bool next(){ return queue.next(); }
+
+    ulong drain(){ ulong n=0, stamp=0; _trace_::span_t span( "process", "poll" );
+        if( _limit_ != 0 ){ process::yield(); stamp = process::micros() + _limit_; }
+        _stats_::depth( _stat_, queue.size() ); ulong t = _stats_::stamp();
+        while( n < _count_ && !queue.empty() ){ next(); process::micro::drain(); n++; t = _stats_::run( _stat_, t );
+            if( _limit_ == 0 ){ continue; } process::yield();
+            if( (long)( process::micros() - stamp ) >= 0 ){ break; }
+        }   return n;
+    }
+
+}
+
+    /*─······································································─*/
+
+namespace wake {
+
+    queue_t<function_t<long>> queue;
+
+    void clear(){ queue.clear(); }
+
+    ulong size(){ return queue.size(); }
+
+    bool empty(){ return queue.empty(); }
+
+    template< class T, class... V >
+    handle_t add( T cb, const V&... arg ){ _arena_::heap_t heap;
+        ptr_t<T> clb = new T( cb );
+        ptr_t<_handle_::flag_t> out = new _handle_::flag_t(); queue.push([=](){ 
+            if( !out->alive() ){ return -1L; }
+            long rs = (*clb) (arg...);
+            return !out->alive() ? -1L : rs; 
+        }); return out->hdl;
     }
 
-    bool next(){
-        if( queue.empty() ){ return 0; }
-          auto x = queue.get();
-          int  y = x->data();
-        if( y ==-1 ){ queue.erase(x); }
-        if( y == 1 ){ queue.next();   }
-        return queue.get()!=queue.last();
+    long next(){ long rs = -1; _trace_::span_t span( "process", "wake" );
+        auto x = queue.first(); while( x != nullptr ){
+        auto y = x->next; long z = x->data(); process::micro::drain();
+          if( z < 0 ){ queue.erase(x); }
+        elif( rs < 0 || z < rs ){ rs = z; }
+        x = y; } return rs;
     }
 
 }
@@ -148,60 +381,108 @@ namespace nodepp { namespace process {
     /*─······································································─*/
 
     void clear(){ 
+        process::micro::clear();
         process::task::clear();
         process::poll::clear(); 
         process::loop::clear(); 
-        process::threads = 0; 
+        process::wake::clear(); 
+        __atomic_store_n( &process::threads, 0, __ATOMIC_RELEASE ); 
     }
     
     /*─······································································─*/
 
-    void clear( void* address ){ 
-        if( address == nullptr ){ return; }
-            *((bool*)( address )) = 0; 
-    }
+    void clear( const handle_t& address ){ _handle_::clear( address ); }
     
     /*─······································································─*/
 
     bool empty(){ return ( 
+        process::micro::empty() && 
         process::task::empty() && 
         process::poll::empty() && 
         process::loop::empty() && 
-        process::threads <= 0 
+        process::wake::empty() && 
+        __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) <= 0 
     );}
 
     /*─······································································─*/
 
     ulong size(){ 
         return process::poll::size() + 
+               process::micro::size()+ 
                process::task::size() + 
                process::loop::size() + 
-               process::threads      ; 
+               process::wake::size() + 
+               __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ); 
     }
 
     /*─······································································─*/
 
     template< class... T >
-    void* add( const T&... args ){ return process::loop::add( args... ); }
+    handle_t add( const T&... args ){ return process::loop::add( args... ); }
+
+    /*─······································································─*/
+
+    void budget( ulong count, ulong time=0 ){
+        process::task::budget( count, time );
+        process::loop::budget( count, time );
+        process::poll::budget( count, time );
+    }
 
     /*─······································································─*/
 
-    int next(){ 
+    /* the host only gets a turn while the loop sleeps, which under
+       ASYNCIFY is when the browser delivers I/O; a loop kept busy by
+       tasks hands over once every HOST_YIELD ms of continuous spinning */
+
+    ulong _spin_ = 0;
+
+    void spin(){
+        if( process::micros() - _spin_ < HOST_YIELD * 1000UL ){ return; }
+        process::handover(); process::yield(); _spin_ = process::micros();
+    }
+
+    void idle(){ 
+        
+        process::yield(); _stats_::tick(); long wait = process::wake::next();
+        if( !process::task::empty() || !process::loop::empty() ){ spin(); return; }
+
+          if( !process::poll::empty() || __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) > 0 )
+            { wait = wait < 0 ? TIMEOUT * 1000L : min( wait, TIMEOUT * 1000L ); }
+        elif( wait < 0 ){ return; }
+
+        if( wait < 1000 ){ spin(); return; } ulong stamp = process::micros();
+            process::yield( wait / 1000 ); _stats_::idle( process::micros() - stamp ); 
+            _spin_ = process::micros(); process::wake::next();
+
+    }
+
+    /*─······································································─*/
+
+    int next(){ process::micro::drain();
     coStart
 
-        if( !process::task::empty() ){ process::task::next(); coNext; }
-        if( !process::loop::empty() ){ process::loop::next(); coNext; }
-        if( !process::poll::empty() ){ process::poll::next(); coNext; }
-             process::yield();
+        if( !process::task::empty() ){ process::task::drain(); coNext; }
+        if( !process::loop::empty() ){ process::loop::drain(); coNext; }
+        if( !process::poll::empty() ){ process::poll::drain(); coNext; }
+             process::idle();
         
     coStop
     }
 
     /*─······································································─*/
 
+#if NODEPP_MAINLOOP
+
+    template< class T, class... V > 
+    void await( T cb, const V&... args ) = delete;
+
+#else
+
     template< class T, class... V > 
     void await( T cb, const V&... args ){ while( cb( args... ) != -1 ){ next(); } }
 
+#endif
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
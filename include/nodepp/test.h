@@ -30,7 +30,7 @@ namespace nodepp {
         
         struct DONE {
             queue_t<NODE> queue;
-            void*  ev = nullptr;
+            handle_t ev;
             int state = 1; 
         };  ptr_t<DONE> obj;
 
@@ -45,16 +45,17 @@ namespace nodepp {
 
         ~test_t() noexcept {
             if( obj.count()  > 1 ){ return; }
-            if( obj->state == -1 ){ return; }
    	        process::onSIGERR.off( obj->ev );
+            if( obj->state == -1 ){ return; }
             onClose.emit(); obj->state =-1;
         }
 
         test_t() noexcept : obj( new DONE() ) { 
-            auto self = type::bind( this );
+            weak_ptr_t<DONE> self = obj;
             obj->ev = process::onSIGERR.once([=]( ... ){ 
+                auto x = self.lock(); if( x.null() ){ return; }
                 conio::error( "ERROR: " ); 
-                auto node = self->obj->queue.get(); 
+                auto node = x->queue.get(); 
                 conio::log( node->data.name );
                 conio::error( "FAILED\n\n" ); 
             });
@@ -102,7 +103,7 @@ namespace nodepp {
                 }   
             x = x->next; process::next(); }
 
-            onClose.emit();
+            onClose.emit(); obj->state =-1;
 
         }
         
@@ -137,7 +138,7 @@ namespace nodepp {
                     }   x = x->next; coNext;
                 }
 
-                self->onClose.emit();
+                self->onClose.emit(); self->obj->state =-1;
 
             coStop
             });
@@ -14,61 +14,202 @@
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
-#include "generator.h"
+namespace nodepp { namespace _timer_ {
+
+    struct TIMER {
+        function_t<int> cb;
+        handle_t        hdl;
+        ulong*          ptr   = nullptr;
+        ulong*          size  = nullptr;
+        ulong           time  = 0;
+        ulong           stamp = 0;
+        bool            out   = 1;
+        bool            busy  = 0;
+       ~TIMER() noexcept { _handle_::release( hdl ); }
+    };
+
+    /*─······································································─*/
+
+    class wheel_t {
+    protected:
+
+        using SLOT = queue_t<ptr_t<TIMER>>;
+
+        struct NODE {
+            ptr_t<SLOT>  slot = ptr_t<SLOT>( TIMER_WHEEL );
+            ptr_t<bool>  drv  = new bool(1);
+            ulong      (*clock)() = nullptr;
+            ulong        scale= 1;
+            ulong        tick = 0;
+            ulong        due  = 0;
+            ulong        size = 0;
+        };  ptr_t<NODE> obj;
+
+        /*─······································································─*/
+
+        bool before( ulong a, ulong b ) const noexcept { return (long)( a - b ) < 0; }
+
+        ulong interval( const ptr_t<TIMER>& x ) const noexcept {
+            return x->ptr == nullptr ? x->time : *x->ptr;
+        }
+
+        void arm( const ptr_t<TIMER>& x, ulong now ) const noexcept {
+            x->stamp = now + interval( x );
+            if( before( x->stamp, obj->tick ) ){ x->stamp = obj->tick; }
+            if( before( x->stamp, obj->due  ) ){ obj->due  = x->stamp; }
+            obj->slot[ x->stamp % TIMER_WHEEL ].push( x );
+        }
+
+        ulong scan() const noexcept { ulong i=0;
+            while( i<TIMER_WHEEL && obj->slot[ (obj->tick+i) % TIMER_WHEEL ].empty() )
+                 { i++; } return obj->tick + i;
+        }
+
+        int fire( const ptr_t<TIMER>& x ) const noexcept {
+            x->busy = 1; int rs = x->cb(); x->busy = 0;
+            process::micro::drain(); return rs;
+        }
+
+        void run( ulong now ) const noexcept {
+            ulong n = min( now - obj->tick + 1, (ulong) TIMER_WHEEL );
+            ulong i = obj->tick; obj->tick = now + 1;
+
+            while( n-->0 ){ auto& slot = obj->slot[ i++ % TIMER_WHEEL ];
+                if( slot.empty() ){ continue; } SLOT list = slot; slot = SLOT();
+                auto x = list.first(); while( x != nullptr ){ auto y = x->data;
+                    if( y->out ){
+                          if( before( now, y->stamp ) ){ slot.push( y ); }
+                        elif( fire( y ) < 0 && y->out ){ y->out = 0; obj->size--; }
+                        elif( y->out )                { arm( y, now ); }
+                    }
+                x = x->next; }
+            }
+
+            if( before( obj->due, obj->tick ) ){ obj->due = scan(); }
+        }
+
+        /* a cleared timer stays in its slot until the slot comes round,
+           so its closure is dropped here, unless it is the one running;
+           once the wheel is empty the leftover entries are swept too */
+
+        static void kill( void* addr ) noexcept {
+            auto x = (TIMER*) addr; if( !x->out ){ return; }
+            x->out = 0; (*x->size)--; if( !x->busy ){ x->cb = function_t<int>(); }
+        }
+
+        void sweep() const noexcept {
+            for( ulong i=0; i<TIMER_WHEEL; i++ ){
+            if ( !obj->slot[i].empty() ){ obj->slot[i].clear(); } }
+        }
+
+        void start() const noexcept {
+            if( obj->drv.count() > 1 ){ return; }
+            auto self = *this; auto drv = obj->drv;
+            process::wake::add([=](){ return *drv ? self.next() : -1L; });
+        }
+
+    public:
+
+        wheel_t( ulong (*clock)(), ulong scale ) noexcept : obj( new NODE() ) { 
+            obj->clock = clock; obj->scale = scale; 
+        }
+
+        /*─······································································─*/
+
+        ulong  size() const noexcept { return obj->size; }
+        bool  empty() const noexcept { return obj->size == 0; }
+
+        /*─······································································─*/
+
+        handle_t add( const function_t<int>& cb, ulong* ptr, ulong time ) const noexcept {
+            _arena_::heap_t heap; ptr_t<TIMER> x = new TIMER(); ulong now = obj->clock();
+            x->cb = cb; x->ptr = ptr; x->time = time; x->size = &obj->size;
+            if( obj->size == 0 ){ obj->tick = now; obj->due = now + TIMER_WHEEL; } 
+            obj->size++; arm( x, now ); start(); 
+            return x->hdl = _handle_::alloc( &x, &kill );
+        }
+
+        /*─······································································─*/
+
+        long next() const noexcept { _arena_::heap_t heap;
+            if( obj->size == 0 ){ sweep(); return -1; } ulong now = obj->clock();
+            if(!before( now, obj->tick ) ){ run( now ); }
+            if( obj->size == 0 ){ sweep(); return -1; }
+            return before( now, obj->due ) ? ( obj->due - now ) * obj->scale : 0;
+        }
+
+    };
+
+    /*─······································································─*/
+
+    wheel_t  timer( process::millis, 1000 );
+    wheel_t utimer( process::micros, 1    );
+
+}}
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { namespace timer {
     
     template< class V, class... T >
-    void* add ( V func, ulong* time, const T&... args ){
-        auto prs = _timer_::timer();
-        return process::task::add( prs, func, time, args... ); 
+    handle_t add ( V func, ulong* time, const T&... args ){ _arena_::heap_t heap;
+        ptr_t<V> clb = new V( func );
+        return _timer_::timer.add( [=](){ return (*clb)( args... ); }, time, 0 ); 
     };
     
     template< class V, class... T >
-    void* add ( V func, ulong time, const T&... args ){
-        auto prs = _timer_::timer();
-        return process::task::add( prs, func, time, args... ); 
+    handle_t add ( V func, ulong time, const T&... args ){ _arena_::heap_t heap;
+        ptr_t<V> clb = new V( func );
+        return _timer_::timer.add( [=](){ return (*clb)( args... ); }, nullptr, time ); 
     };
     
     /*─······································································─*/
 
     template< class V, class... T >
-    void* timeout ( V func, ulong* time, const T&... args ){
+    handle_t timeout ( V func, ulong* time, const T&... args ){
         return timer::add([=]( T... args ){ func(args...); return -1; }, time, args... );
     };
 
     template< class V, class... T >
-    void* timeout ( V func, ulong time, const T&... args ){
+    handle_t timeout ( V func, ulong time, const T&... args ){
         return timer::add([=]( T... args ){ func(args...); return -1; }, time, args... );
     };
     
     /*─······································································─*/
 
     template< class V, class... T >
-    void* interval ( V func, ulong* time, const T&... args ){
+    handle_t interval ( V func, ulong* time, const T&... args ){
         return timer::add([=]( T... args ){ func(args...); return 1; }, time, args... );
     };
 
     template< class V, class... T >
-    void* interval( V func, ulong time, const T&... args ){
+    handle_t interval( V func, ulong time, const T&... args ){
         return timer::add([=]( T... args ){ func(args...); return 1; }, time, args... );
     };
     
     /*─······································································─*/
     
+#if NODEPP_MAINLOOP
+
+    void await( ulong* time ) = delete;
+
+    void await( ulong  time ) = delete;
+
+#else
+
     void await( ulong* time ){
-        ulong stamp = process::millis() + *time;
-        while( process::millis() < stamp )
-             { process::next(); }
+        ptr_t<bool> out = new bool(1);
+        timer::add( [=](){ *out = 0; return -1; }, time );
+        while( *out ){ process::next(); }
     };
 
     void await( ulong time ){ await( (ulong*) &time ); }
+
+#endif
     
     /*─······································································─*/
 
-    void clear( void* address ){ process::clear( address ); }
+    void clear( const handle_t& address ){ process::clear( address ); }
 
 }}
 
@@ -77,54 +218,64 @@ namespace nodepp { namespace timer {
 namespace nodepp { namespace utimer {
     
     template< class V, class... T >
-    void* add ( V func, ulong* time, const T&... args ){
-        auto prs = _timer_::utimer();
-        return process::task::add( prs, func, time, args... ); 
+    handle_t add ( V func, ulong* time, const T&... args ){ _arena_::heap_t heap;
+        ptr_t<V> clb = new V( func );
+        return _timer_::utimer.add( [=](){ return (*clb)( args... ); }, time, 0 ); 
     };
     
     template< class V, class... T >
-    void* add ( V func, ulong time, const T&... args ){
-        auto prs = _timer_::utimer();
-        return process::task::add( prs, func, time, args... ); 
+    handle_t add ( V func, ulong time, const T&... args ){ _arena_::heap_t heap;
+        ptr_t<V> clb = new V( func );
+        return _timer_::utimer.add( [=](){ return (*clb)( args... ); }, nullptr, time ); 
     };
     
     /*─······································································─*/
 
     template< class V, class... T >
-    void* timeout ( V func, ulong* time, const T&... args ){
+    handle_t timeout ( V func, ulong* time, const T&... args ){
         return utimer::add([=]( T... args ){ func(args...); return -1; }, time, args... );
     };
 
     template< class V, class... T >
-    void* timeout ( V func, ulong time, const T&... args ){
+    handle_t timeout ( V func, ulong time, const T&... args ){
         return utimer::add([=]( T... args ){ func(args...); return -1; }, time, args... );
     };
     
     /*─······································································─*/
 
     template< class V, class... T >
-    void* interval ( V func, ulong* time, const T&... args ){
+    handle_t interval ( V func, ulong* time, const T&... args ){
         return utimer::add([=]( T... args ){ func(args...); return 1; }, time, args... );
     };
 
     template< class V, class... T >
-    void* interval( V func, ulong time, const T&... args ){
+    handle_t interval( V func, ulong time, const T&... args ){
         return utimer::add([=]( T... args ){ func(args...); return 1; }, time, args... );
     };
     
     /*─······································································─*/
     
+#if NODEPP_MAINLOOP
+
+    void await( ulong* time ) = delete;
+
+    void await( ulong  time ) = delete;
+
+#else
+
     void await( ulong* time ){
-        ulong stamp = process::micros() + *time;
-        while( process::micros() < stamp )
-             { process::next(); }
+        ptr_t<bool> out = new bool(1);
+        utimer::add( [=](){ *out = 0; return -1; }, time );
+        while( *out ){ process::next(); }
     };
 
     void await( ulong time ){ await( (ulong*) &time ); }
+
+#endif
     
     /*─······································································─*/
 
-    void clear( void* address ){ process::clear( address ); }
+    void clear( const handle_t& address ){ process::clear( address ); }
 
 }}
 
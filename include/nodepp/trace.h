@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_TRACE_API
+#define NODEPP_TRACE_API
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace _trace_ {
+
+    struct EVENT {
+        const char* cat  = nullptr;
+        const char* name = nullptr;
+        ulong       time = 0;
+        ulong       id   = 0;
+        ulong       seq  = 0;
+        char        ph   = 0;
+    };
+
+#if NODEPP_TRACE
+
+    /* any thread may push, so the clock is read locally instead of
+       through process::yield(), and each slot is published as a seqlock:
+       seq is zeroed while the fields are written and then set to the
+       event's position + 1, so flush() can tell a complete event from
+       one that is being written or was already overwritten. top only
+       ever grows, base marks where the last flush or clear stopped */
+
+    EVENT ring[ TRACE_SIZE ]; ulong top = 0, base = 0, uid = 0;
+
+    /*─······································································─*/
+
+    template< class T > void store( T& field, T value ) noexcept { __atomic_store_n( &field, value, __ATOMIC_RELAXED ); }
+    template< class T > T    load ( T& field )          noexcept { return __atomic_load_n( &field, __ATOMIC_RELAXED ); }
+
+    void push( const char* cat, const char* name, char ph, ulong id=0 ) noexcept {
+        ulong pos = __atomic_fetch_add( &top, 1, __ATOMIC_RELAXED ); auto& x = ring[ pos % TRACE_SIZE ];
+        store( x.seq, 0UL ); __atomic_thread_fence( __ATOMIC_RELEASE );
+        store( x.cat, cat ); store( x.name, name ); store( x.ph, ph ); store( x.id, id );
+        store( x.time, process::timestamp() ); __atomic_store_n( &x.seq, pos + 1, __ATOMIC_RELEASE );
+    }
+
+    bool read( ulong pos, EVENT& out ) noexcept { auto& x = ring[ pos % TRACE_SIZE ];
+        if( __atomic_load_n( &x.seq, __ATOMIC_ACQUIRE ) != pos + 1 ){ return false; }
+        out.cat = load( x.cat ); out.name = load( x.name ); out.ph = load( x.ph );
+        out.id  = load( x.id  ); out.time = load( x.time ); __atomic_thread_fence( __ATOMIC_ACQUIRE );
+        return load( x.seq ) == pos + 1;
+    }
+
+    ulong begin( const char* cat, const char* name ) noexcept {
+        ulong id = __atomic_add_fetch( &uid, 1, __ATOMIC_RELAXED );
+        push( cat, name, 'b', id ); return id;
+    }
+
+    void end( const char* cat, const char* name, ulong id ) noexcept {
+        if( id == 0 ){ return; } push( cat, name, 'e', id );
+    }
+
+    /*─······································································─*/
+
+    class span_t {
+    public:
+        span_t( const char* cat, const char* name ) noexcept : cat( cat ), name( name ) 
+              { push( cat, name, 'B' ); }
+       ~span_t() noexcept { push( cat, name, 'E' ); }
+    private:
+        const char* cat; const char* name;
+    };
+
+#else
+
+    ulong begin( const char*, const char* ) noexcept { return 0; }
+
+    void  end( const char*, const char*, ulong ) noexcept {}
+
+    /*─······································································─*/
+
+    class span_t { public: 
+        span_t( const char*, const char* ) noexcept {} 
+    };
+
+#endif
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace process { namespace trace {
+
+    bool enabled(){ return NODEPP_TRACE; }
+
+#if NODEPP_TRACE
+
+    ulong size(){
+        ulong end = __atomic_load_n( &_trace_::top , __ATOMIC_ACQUIRE );
+        ulong beg = __atomic_load_n( &_trace_::base, __ATOMIC_ACQUIRE );
+        return min( end - beg, (ulong) TRACE_SIZE );
+    }
+
+    void clear(){ __atomic_store_n( &_trace_::base, __atomic_load_n( &_trace_::top, __ATOMIC_ACQUIRE ), __ATOMIC_RELEASE ); }
+
+    string_t flush(){ 
+        ulong end = __atomic_load_n( &_trace_::top , __ATOMIC_ACQUIRE );
+        ulong beg = __atomic_load_n( &_trace_::base, __ATOMIC_ACQUIRE );
+        if( end - beg > TRACE_SIZE ){ beg = end - TRACE_SIZE; }
+        string_t out = "{\"traceEvents\":["; bool sep = 0; _trace_::EVENT x;
+        while( beg < end ){ if( !_trace_::read( beg++, x ) ){ continue; }
+            string::format_to( out, "%s{\"cat\":\"%s\",\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lu,\"pid\":1,\"tid\":1", 
+                               sep ? "," : "", x.cat, x.name, x.ph, x.time );
+            if( x.id != 0 ){ string::format_to( out, ",\"id\":%lu", x.id ); } 
+            out += "}"; sep = 1;
+        }   __atomic_store_n( &_trace_::base, end, __ATOMIC_RELEASE ); out += "]}"; return out;
+    }
+
+#else
+
+    ulong size(){ return 0; }
+
+    void clear(){}
+
+    string_t flush(){ return "{\"traceEvents\":[]}"; }
+
+#endif
+
+}}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
@@ -410,6 +410,7 @@ namespace nodepp { namespace type {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+#include "arena.h"
 #include "ptr.h"
 
 /*────────────────────────────────────────────────────────────────────────────*/
@@ -48,10 +48,26 @@ struct url_t {
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
+namespace _url_ {
+
+    ulong until( const string_view_t& data, ulong x, const char* stop ){
+        while( x < data.size() && strchr( stop, data[x] ) == nullptr ){ x++; } return x;
+    }
+
+    ulong alnum( const string_view_t& data, ulong x ){
+        while( x < data.size() && string::is_alnum( data[x] ) ){ x++; } return x;
+    }
+
+}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
 namespace url {
 
     bool is_valid( const string_t& URL ){
-        return regex::test( URL, "^\\w+://([^.]+)", 1 );
+        string_view_t data( URL ); ulong x = _url_::alnum( data, 0 );
+        if( x == 0 || data.find( "://", x ) != (long) x ){ return false; }
+        return x+3 < data.size() && data[x+3] != '.';
     }
 
     /*.........................................................................*/
@@ -78,19 +94,19 @@ namespace url {
     /*─······································································─*/
 
     string_t protocol( const string_t& URL ){ 
-        string_t null; regex_t _a("^[^:]+");
-        if( !is_valid(URL) || !_a.test( URL ) ) 
-          { return null; } null = _a.match( URL );
-            return null;
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL );
+        return data.slice( 0, _url_::until( data, 0, ":" ) ).copy();
     }
     
     /*─······································································─*/
 
-    string_t auth( const string_t& URL ){ string_t null; 
-        regex_t _a("//\\w+:\\w+@");
-        if( !is_valid(URL) || !_a.test( URL ) ) 
-          { return null; } null = _a.match( URL );
-            return null.slice( 2, -1 );
+    string_t auth( const string_t& URL ){ 
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL );
+        long x = data.find( "//" ); while( x >= 0 ){
+            ulong y = _url_::alnum( data, x+2 ), z = _url_::alnum( data, y+1 );
+            if( y > (ulong) x+2 && data[y] == ':' && z > y+1 && data[z] == '@' )
+              { return data.slice( x+2, z ).copy(); } x = data.find( "//", x+1 );
+        }   return nullptr;
     }
 
     string_t user( const string_t& URL ){ string_t null; 
@@ -106,42 +122,52 @@ namespace url {
     /*─······································································─*/
 
     string_t hash( const string_t& URL ){ 
-        string_t null; regex_t _a("#[^?]*");
-        if( !is_valid(URL) || !_a.test( URL ) ) 
-          { return null; } return _a.match( URL );
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL );
+        long x = data.find('#'); if( x < 0 ){ return nullptr; }
+        return data.slice( x, _url_::until( data, x+1, "?" ) ).copy();
     }
 
     string_t search( const string_t& URL ){ 
-        string_t null; regex_t _a("\\?[^#]*");
-        if( !is_valid(URL) || !_a.test( URL ) ) 
-          { return null; } return _a.match( URL );
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL );
+        long x = data.find('?'); if( x < 0 ){ return nullptr; }
+        return data.slice( x, _url_::until( data, x+1, "#" ) ).copy();
     }
+
     string_t origin( const string_t& URL ){
-        string_t null; regex_t _a("^[^/]+//[^/?#]+");
-        if( !is_valid(URL) || !_a.test( URL ) )
-          { return null; } return _a.match( URL );
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL );
+        ulong x = _url_::until( data, 0, "/" ); if( x == 0 || data[x+1] != '/' )
+          { return nullptr; } ulong y = _url_::until( data, x+2, "/?#" );
+        return y > x+2 ? data.slice( 0, y ).copy() : nullptr;
     }
 
     string_t path( const string_t& URL ){
-        string_t null; regex_t _a("/[^/?#]+");
-        if ( !is_valid(URL) || !_a.test(URL) ){ return "/"; }
-             null = _a.match_all( URL ).slice(1).join("");
-	         return null.empty() ? "/" : null;
+        if( !is_valid(URL) ){ return "/"; } string_view_t data( URL );
+        string_t null; ulong x=0, n=0; while( x < data.size() ){
+            ulong y = data[x] == '/' ? _url_::until( data, x+1, "/?#" ) : x;
+            if  ( y <= x+1 ){ x++; continue; }
+            if  ( n++ > 0  ){ null += data.slice( x, y ).copy(); } x = y;
+        }   return null.empty() ? "/" : null;
     }
 
     string_t host( const string_t& URL ){ 
-        regex_t _a("(/|@)[^/#?]+");
-        if(!is_valid(URL) ){ return nullptr; }
-            auto data = _a.match( URL ).slice(1);
-        if( regex::test( data, "@" ) )
-             return regex::replace( data, "[^@]+@", "" );
-        else return data;
+        if( !is_valid(URL) ){ return nullptr; } string_view_t data( URL ); ulong x=0, y=0;
+        while( x < data.size() ){
+            if( data[x] == '/' || data[x] == '@' )
+              { y = _url_::until( data, x+1, "/#?" ); if( y > x+1 ){ break; } }
+            x++;
+        }   if( x >= data.size() ){ return nullptr; }
+
+        auto host = data.slice( x+1, y ); ulong z=0; 
+        while( z < host.size() && host[z] == '@' ){ z++; } long w = host.find( '@', z );
+        if( w < 0 ){ return host.copy(); } 
+        return host.slice( 0, z ).copy() + host.slice( w+1 ).copy();
     }
 
     string_t hostname( const string_t& URL ){ 
-        string_t null = host(URL); regex_t _a("[^:]+");
-        if( !is_valid(URL) || !_a.test( null ) ) 
-          { return null; } return _a.match( null );
+        string_t null = host(URL); string_view_t data( null ); ulong x=0;
+        while( x < data.size() && data[x] == ':' ){ x++; }
+        if( !is_valid(URL) || x >= data.size() ){ return null; } 
+        return data.slice( x, _url_::until( data, x, ":" ) ).copy();
     }
     
     /*─······································································─*/
@@ -150,11 +176,16 @@ namespace url {
 
         string_t _prot = protocol( URL );
         string_t _host = host( URL ); 
-        regex_t  _a(":\\d+$");
+        string_view_t _a ( _host );
+
+        long x = _a.find(':'); while( x >= 0 ){ ulong y = x+1;
+            while( y < _a.size() && string::is_digit( _a[y] ) ){ y++; }
+            if( y > (ulong) x+1 && y == _a.size() )
+              { return string::to_uint( _a.slice( x+1 ).copy() ); }
+            x = _a.find( ':', x+1 );
+        }
 
-        if( !_host.empty() && _a.test( _host ) ){
-            return string::to_uint( _a.match( _host ).slice(1) );
-        } elif( !_prot.empty() ) {
+        if( !_prot.empty() ) {
             for( ulong i=0; i<prot.size(); i++ ) {
              if( _prot.find( prot[i] ) != nullptr )
                { return prts[i]; }
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2023 The Nodepp Project Authors. All Rights Reserved.
+ *
+ * Licensed under the MIT (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://github.com/NodeppOficial/nodepp/blob/main/LICENSE
+ */
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#ifndef NODEPP_VIEW
+#define NODEPP_VIEW
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { class string_view_t {
+protected:
+
+    /* a view points straight at its parent's bytes and never allocates:
+       a heap string shares its buffer with the view, which keeps it alive,
+       but inline strings and plain char pointers are only borrowed, so a
+       view of those must not outlive the string it was taken from */
+
+    ptr_t<char> owner; const char* base = ""; ulong length = 0;
+
+    bool get_slice_range( long x, long y, ulong& b, ulong& c ) const noexcept {
+
+        if( empty() || x == y ){ return false; } if( y>0 ){ y--; }
+
+        if( x < 0 ){ x = size() + x; } if( (ulong)x > last() ){ return false; }
+        if( y < 0 ){ y = last() + y; } if( (ulong)y > last() ){ y = last(); }
+                                       if( y < x )            { return false; }
+
+        ulong a = clamp( first() + y, 0UL, last() );
+              b = clamp( first() + x, 0UL, a );
+              c = a - b + 1; return true;
+
+    }
+
+public:
+
+    string_view_t() noexcept {}
+
+    explicit string_view_t( const char* argc ) noexcept {
+        if( argc == nullptr ){ return; } base = argc; length = strlen( argc );
+    }
+
+    string_view_t( const string_t& argc ) noexcept : owner( argc.buffer ), base( argc.get() ), length( argc.size() ) {}
+
+    string_view_t( const string_t& argc, ulong start, ulong n ) noexcept : owner( argc.buffer ) {
+        start = min( start, argc.size() ); length = min( n, argc.size() - start );
+        base  = argc.get() + start;
+    }
+
+    string_view_t( const string_view_t& argc, ulong start, ulong n ) noexcept : owner( argc.owner ) {
+        start = min( start, argc.size() ); length = min( n, argc.size() - start );
+        base  = argc.base + start;
+    }
+
+    /*─······································································─*/
+
+    char*   end() const noexcept { return begin() + size(); }
+    char* begin() const noexcept { return (char*) base; }
+
+    /*─······································································─*/
+
+    ulong first() const noexcept { return 0; }
+    bool  empty() const noexcept { return length == 0; }
+    ulong  size() const noexcept { return length; }
+    ulong  last() const noexcept { return empty() ? 0 : length - 1; }
+
+    /*─······································································─*/
+
+    char operator[]( ulong n ) const noexcept { return n < length ? begin()[n] : '\0'; }
+
+    /*─······································································─*/
+
+    bool operator> ( const string_view_t& oth ) const noexcept { return compare( oth ) == 1; }
+    bool operator>=( const string_view_t& oth ) const noexcept { return compare( oth ) >= 0; }
+    bool operator<=( const string_view_t& oth ) const noexcept { return compare( oth ) <= 0; }
+    bool operator< ( const string_view_t& oth ) const noexcept { return compare( oth ) ==-1; }
+    bool operator==( const string_view_t& oth ) const noexcept { return compare( oth ) == 0; }
+    bool operator!=( const string_view_t& oth ) const noexcept { return compare( oth ) != 0; }
+
+    bool operator==( const char* oth ) const noexcept {
+        ulong n = strlen( oth ); return n == length && memcmp( begin(), oth, n ) == 0;
+    }
+
+    bool operator!=( const char* oth ) const noexcept { return !( *this == oth ); }
+
+    /*─······································································─*/
+
+    int compare( const string_view_t& oth ) const noexcept {
+        if( size() < oth.size() ){ return -1; }
+        if( size() > oth.size() ){ return  1; }
+        int c = memcmp( begin(), oth.begin(), size() );
+        return c < 0 ? -1 : c > 0 ? 1 : 0;
+    }
+
+    /*─······································································─*/
+
+    long find( const char& data, ulong offset=0 ) const noexcept {
+        if( offset >= length ){ return -1; }
+        auto x = _string_::find( begin() + offset, length - offset, data );
+        return x == nullptr ? -1 : x - begin();
+    }
+
+    long find( const char* data, ulong n, ulong offset ) const noexcept {
+        if( offset >= length ){ return -1; }
+        auto x = _string_::find( begin() + offset, length - offset, data, n );
+        return x == nullptr ? -1 : x - begin();
+    }
+
+    long find( const string_view_t& data, ulong offset=0 ) const noexcept {
+         return find( data.begin(), data.size(), offset );
+    }
+
+    long find( const char* data, ulong offset=0 ) const noexcept {
+         return find( data, strlen( data ), offset );
+    }
+
+    /*─······································································─*/
+
+    string_view_t slice( long start ) const noexcept { ulong b, c;
+        if( !get_slice_range( start, size(), b, c ) ){ return string_view_t(); }
+        return string_view_t( *this, b, c );
+    }
+
+    string_view_t slice( long start, long end ) const noexcept { ulong b, c;
+        if( !get_slice_range( start, end, b, c ) ){ return string_view_t(); }
+        return string_view_t( *this, b, c );
+    }
+
+    /*─······································································─*/
+
+    string_t copy() const noexcept { return string_t( begin(), length ); }
+
+};}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+namespace nodepp { namespace string {
+
+    inline string_t to_string( const string_view_t& num ){ return num.copy(); }
+
+}}
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+#endif
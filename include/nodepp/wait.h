@@ -19,30 +19,30 @@ protected:
 
     using NODE = function_t<bool,T>; ptr_t<queue_t<NODE>> obj;
 
-public: wait_t() noexcept : obj( new queue_t<NODE>() ) {}
+public: wait_t() noexcept : obj( ptr_t<queue_t<NODE>>::make() ) {}
     
     /*─······································································─*/
 
-    void* operator()( T val, function_t<void> func ) const noexcept { return on(val,func); }
+    handle_t operator()( T val, function_t<void> func ) const noexcept { return on(val,func); }
     
     /*─······································································─*/
 
-    void off( void* address ) const noexcept { process::clear( address ); }
+    void off( const handle_t& address ) const noexcept { process::clear( address ); }
 
-    void* once( T val, function_t<void> func ) const noexcept {
+    handle_t once( T val, function_t<void> func ) const noexcept {
         if( obj->size() >= MAX_EVENTS ) { return nullptr; }
-        ptr_t<bool> out = new bool(1); obj->push([=]( T arg ){
-            if( *out != 0 && val == arg  ){ func(); }
-            *out = 0; return *out;
-        }); return &out;
+        auto out = ptr_t<_handle_::flag_t>::make(); obj->push([=]( T arg ){
+            if( out->alive() && val == arg  ){ func(); }
+            out->close(); return false;
+        }); return out->hdl;
     }
 
-    void* on( T val, function_t<void> func ) const noexcept {
+    handle_t on( T val, function_t<void> func ) const noexcept {
         if( obj->size() >= MAX_EVENTS ) { return nullptr; }
-        ptr_t<bool> out = new bool(1); obj->push([=]( T arg ){
-            if( *out != 0 && val == arg  ){ func(); } 
-            return *out;
-        }); return &out;
+        auto out = ptr_t<_handle_::flag_t>::make(); obj->push([=]( T arg ){
+            if( out->alive() && val == arg  ){ func(); } 
+            return out->alive();
+        }); return out->hdl;
     }
     
     /*─······································································─*/
@@ -40,20 +40,20 @@ namespace nodepp { namespace conio {
 
     template< class... T >
     int log( const T&... args ){
-        int last = sizeof...( args ), size = 0;
+        int last = sizeof...( args ); string_builder_t out;
         string::map([&]( string_t arg ){ 
-            size += pout( arg + ( --last<1 ? "" : " " ) ); 
-        },  args... ); size += pout("\033[0m"); 
-        return size;
+            out.append( arg ); if( --last>0 ){ out.append(' '); }
+        },  args... ); out.append("\033[0m"); 
+        return pout( out.str() );
     }
 
     template< class... T >
     int err( const T&... args ){
-        int last = sizeof...( args ), size = 0;
+        int last = sizeof...( args ); string_builder_t out;
         string::map([&]( string_t arg ){ 
-            size += perr( arg + ( --last<1 ? "" : " " ) ); 
-        },  args... ); size += perr("\033[0m"); 
-        return size;
+            out.append( arg ); if( --last>0 ){ out.append(' '); }
+        },  args... ); out.append("\033[0m"); 
+        return perr( out.str() );
     }
 
     /*─······································································─*/
@@ -83,11 +83,12 @@ namespace nodepp { namespace fetch {
             ptr_t<bool> state = new bool(1);
             array_t<const char*> hdr;
             queue_t<any_t> args; 
+            ulong trace = 0;
         }; ptr_t<NODE> obj = new NODE();
 
-        function_t<void> done ([=](){ *obj->state = 0; });
+        function_t<void> done ([=](){ *obj->state = 0; _trace_::end( "fetch", "fetch", obj->trace ); });
         
-        process::add([=](){
+        process::poll::add([=](){
         coStart
 
             do {
@@ -113,6 +114,7 @@ namespace nodepp { namespace fetch {
                 attr.onsuccess      = _fetch_::EVENT;
                 attr.onerror        = _fetch_::EVENT;
 
+                obj->trace = _trace_::begin( "fetch", "fetch" );
                 emscripten_fetch( &attr, ctx->url.get() );
 
             } while(0); while( *obj->state ){ coNext; }
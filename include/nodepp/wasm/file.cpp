@@ -10,7 +10,6 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 #pragma once
-#include <emscripten.h>
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
@@ -166,6 +165,7 @@ public: file_t() noexcept {}
 
     virtual int __read( char* bf, const ulong& sx ) const noexcept {
         if( is_closed() ){ return -1; } if( sx==0 ){ return 0; }
+        _trace_::span_t span( "file", "read" );
         obj->feof = fread( bf, sizeof(char), sx, obj->fd );
         if( obj->feof <= 0 || feof( obj->fd ) ){ close(); } 
         return obj->feof;
@@ -173,6 +173,7 @@ public: file_t() noexcept {}
 
     virtual int __write( char* bf, const ulong& sx ) const noexcept {
         if( is_closed() ){ return -1; } if( sx==0 ){ return 0; }
+        _trace_::span_t span( "file", "write" );
         obj->feof = fwrite( bf, sizeof(char), sx, obj->fd );
         if( obj->feof <= 0 || feof( obj->fd ) ){ close(); } 
         return obj->feof;
@@ -11,12 +11,17 @@
 
 #pragma once
 #include <pthread.h>
+#include <unistd.h>
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { namespace worker {
 
+#if NODEPP_MAINLOOP
+    void delay( ulong time ){ ::usleep( time * 1000 ); }
+#else
     void delay( ulong time ){ process::delay(time); }
+#endif
 
     int    pid(){ return (int)pthread_self(); }
 
@@ -16,13 +16,13 @@
 
 namespace nodepp { namespace process {
     
-    ulong _time_ = 0;
+    ullong _time_ = 0;
 
-    ulong millis(){ return _time_; }
+    ulong millis(){ return _time_ / 1000; }
 
-    ulong micros(){ return _time_ / 1000; }
+    ulong micros(){ return _time_; }
 
-    ulong seconds(){ return _time_ * 1000; }
+    ulong seconds(){ return _time_ / 1000000; }
 
 }}
 
@@ -32,16 +32,39 @@ namespace nodepp { namespace process {
 
     ulong now(){ return millis(); }
 
+    /* reads the clock without touching the cached time, for callers
+       that may run on any thread */
+
+    ulong timestamp(){ return emscripten_get_now() * 1000; }
+
+#if NODEPP_MAINLOOP
+
+    void delay( ulong time ) = delete;
+
+    void yield( ulong /*unused*/=0 ){ 
+        _time_ = timestamp(); 
+    }
+
+    void handover(){}
+
+#else
+
     void delay( ulong time ){ 
         if( time == 0 ){ return; }
         emscripten_sleep( time );
     }
 
-    void yield(){ 
-        _time_ = emscripten_get_now(); 
-        delay(TIMEOUT);
+    void yield( ulong time=0 ){ 
+        delay( time ); _time_ = timestamp(); 
     }
 
+    /* a zero length sleep, still a trip through the browser's event
+       loop, so network and input callbacks get to run */
+
+    void handover(){ emscripten_sleep( 0 ); }
+
+#endif
+
 }}
 
 /*────────────────────────────────────────────────────────────────────────────*/
\ No newline at end of file
@@ -15,13 +15,11 @@
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { namespace { 
-    
-    mutex_t mtx;
 
     void* sfunc( void* arg ){
         auto cb = (function_t<int>*) arg;
         while((*cb)() >= 0 ){ worker::yield(); }
-        mtx.lock(); process::threads--; mtx.unlock();
+        __atomic_sub_fetch( &process::threads, 1, __ATOMIC_ACQ_REL );
         delete cb; worker::exit(); return nullptr;
     }
 
@@ -34,7 +32,7 @@ protected:
 
     struct NODE {
         function_t<int>* cb;
-        ptr_t<bool> out;
+        atomic_ptr_t<bool> out;
         int state =0;
         pthread_t id;
         int mode  =0;
@@ -51,10 +49,10 @@ public: worker_t() noexcept : obj( new NODE ) {}
 
     template< class T, class... V >
     worker_t( T cb, const V&... arg ) noexcept : obj( new NODE() ){
-        if( process::threads >= MAX_WORKERS ){ return; }
+        if( __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) >= MAX_WORKERS ){ return; }
         ptr_t<T>    clb = new T( cb );
         ptr_t<bool> blk = new bool(0);
-        ptr_t<bool> out = new bool(1);
+        atomic_ptr_t<bool> out = new bool(1);
         obj->cb = new function_t<int>([=](){ 
             if( *out==0 ){ return -1; }
             if( *blk==1 ){ return  1; } *blk = 1;
@@ -75,7 +73,8 @@ public: worker_t() noexcept : obj( new NODE ) {}
 
     int run() const noexcept { if( obj->state == 1 ){ return 0; } obj->state = 1;
         auto pth = pthread_create( &obj->id, NULL, &sfunc, (void*)obj->cb );
-        if( !pth ) { process::threads++; } pthread_detach( obj->id );
+        if( !pth ) { __atomic_add_fetch( &process::threads, 1, __ATOMIC_ACQ_REL ); }
+        pthread_detach( obj->id );
         return pth != 0 ? -1 : 0;
     }
 
@@ -12,13 +12,19 @@
 #pragma once
 #include <emscripten/websocket.h>
 
-namespace nodepp { queue_t<void*> user; }
+namespace nodepp { class ws_t; queue_t<weak_ptr_t<ws_t>> user; }
 
 /*────────────────────────────────────────────────────────────────────────────*/
 
 namespace nodepp { class ws_t {
 protected:
 
+    /* handles returned to the user share ref, the copy the poll task and
+       the registry reach through a weak_ptr_t; it is declared before obj
+       so it goes last, and the socket closes once no handle is left */
+
+    ptr_t<ws_t> ref;
+
     struct NODE {
         ushort wait =0;
         int     fd =-1;
@@ -28,23 +34,27 @@ protected:
 private:
 
     static EMSCRIPTEN_RESULT WS_EVENT_MESSAGE( int /*unused*/, const EmscriptenWebSocketMessageEvent* ev, void* userData ) {
-        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<void*>>( userData );
-        auto x = user->first(); while( x != nullptr ){ auto z = type::cast<ws_t>( x->data ); auto y = x->next;
-            if( z->obj->fd==ev->socket ){ z->onData.emit( string_t( (char*)ev->data, ev->numBytes ) ); break; }
+        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<weak_ptr_t<ws_t>>>( userData );
+        _trace_::span_t span( "ws", "message" );
+        auto x = user->first(); while( x != nullptr ){ auto z = x->data.lock(); auto y = x->next;
+            if( z.null() ){ user->erase(x); }
+          elif( z->obj->fd==ev->socket ){ z->onData.emit( string_t( (char*)ev->data, ev->numBytes ) ); break; }
         x = y; } return EM_TRUE;
     }
 
     static EMSCRIPTEN_RESULT WS_EVENT_CLOSE( int /*unused*/, const EmscriptenWebSocketCloseEvent* ev, void* userData ) {
-        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<void*>>( userData );
-        auto x = user->first(); while( x != nullptr ){ auto z = type::cast<ws_t>( x->data ); auto y = x->next;
-            if( z->obj->fd==ev->socket ){ user->erase(x); z->onDrain.emit(); z->close(); break; }
+        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<weak_ptr_t<ws_t>>>( userData );
+        auto x = user->first(); while( x != nullptr ){ auto z = x->data.lock(); auto y = x->next;
+            if( z.null() ){ user->erase(x); }
+          elif( z->obj->fd==ev->socket ){ user->erase(x); z->onDrain.emit(); z->close(); break; }
         x = y; } return EM_TRUE;
     }
 
     static EMSCRIPTEN_RESULT WS_EVENT_OPEN( int /*unused*/, const EmscriptenWebSocketOpenEvent* ev, void* userData ) {
-        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<void*>>( userData );
-        auto x = user->first(); while( x != nullptr ){ auto z = type::cast<ws_t>( x->data ); auto y = x->next;
-            if( z->obj->fd==ev->socket ){ z->obj->state=1; z->onConnect.emit( *z ); break; }
+        if( userData == nullptr ){ return EM_FALSE; }  auto user = type::cast<queue_t<weak_ptr_t<ws_t>>>( userData );
+        auto x = user->first(); while( x != nullptr ){ auto z = x->data.lock(); auto y = x->next;
+            if( z.null() ){ user->erase(x); }
+          elif( z->obj->fd==ev->socket ){ z->obj->state=1; auto cli = *z; cli.ref = z; z->onConnect.emit( cli ); break; }
         x = y; } return EM_TRUE;
     }
 
@@ -63,7 +73,6 @@ public: ws_t() noexcept : obj( new NODE() ){}
     /*─······································································─*/
 
     ws_t( const string_t& url ) noexcept : obj( new NODE() ) {
-        auto self = type::bind( this );
 
         if( !emscripten_websocket_is_supported() ){ 
             _EERROR(onError,"WS not Supported"); 
@@ -76,20 +85,26 @@ public: ws_t() noexcept : obj( new NODE() ){}
         attr->protocols          = nullptr;
         attr->createOnMainThread = EM_TRUE;
         
-        obj->fd = emscripten_websocket_new( &attr ); user.push( &self );
+        auto x = user.first(); while( x != nullptr ){ auto y = x->next;
+            if( x->data.expired() ){ user.erase(x); }
+        x = y; }
+
+        ref = new ws_t( *this ); weak_ptr_t<ws_t> wek = ref;
+        obj->fd = emscripten_websocket_new( &attr ); user.push( wek );
 
-        process::poll::add([=](){
+        process::poll::add([=](){ auto self = wek.lock();
         coStart
 
-            while( self->obj->wait == 0 ){
+            while( !self.null() && self->obj->wait == 0 ){
                 emscripten_websocket_get_ready_state( self->obj->fd, &self->obj->wait );
                 coNext;
-            } if( self->obj->wait > 1 ){
+            } if( self.null() ){ coEnd; } if( self->obj->wait > 1 ){
                 _EERROR( self->onError, "Something Went Wrong" );
                 coEnd;
             }
 
-            while( self->obj->state >= 0 ){ coNext; } self->onClose.emit(); 
+            while( !self.null() && self->obj->state >= 0 ){ coNext; } 
+            if( self.null() ){ coEnd; } self->onClose.emit(); 
 
         coStop
         });
@@ -123,6 +138,7 @@ public: ws_t() noexcept : obj( new NODE() ){}
 
     int write( string_t msg ) const noexcept { 
         if( is_closed() || msg.empty() || obj->wait != 1 ){ return -1; }
+        _trace_::span_t span( "ws", "write" );
         return emscripten_websocket_send_binary( obj->fd, msg.get(), msg.size() );
     }
 
@@ -0,0 +1,54 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void* operator new[]( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* creates, copies and writes to the containers built on ptr_t, printing
+   the time and the allocations each iteration took; a ptr_t that owns
+   its storage should cost one allocation, an adopted pointer two */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; ulong allocs = count;
+    process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x ); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, "x", n, ":", string::to_string( wall / 1000.0 ), "ms,",
+                  string::to_string( double( count - allocs ) / n ), "allocs each", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    string_t text( 100, 'x' );
+
+    measure( "ptr_t<int>::make        ", 200000, []( ulong x ){ auto p = ptr_t<int>::make( (int) x ); return (ulong) *p + 1; });
+    measure( "ptr_t<int>( new int )   ", 200000, []( ulong x ){ ptr_t<int> p = new int( (int) x ); return (ulong) *p + 1; });
+
+    measure( "string_t 100 B copy + set", 200000, [&]( ulong x ){
+        string_t a = text.copy(); string_t b = a; b[0] = (char)( 'a' + x % 26 ); return (ulong) b.size();
+    });
+
+    measure( "queue_t of 10 ints      ", 20000, []( ulong ){
+        queue_t<int> q; for( int y=0; y<10; y++ ){ q.push( y ); } return q.size();
+    });
+
+    measure( "array_t of 10 ints      ", 20000, []( ulong ){
+        array_t<int> a; for( int y=0; y<10; y++ ){ a.push( y ); } return a.size();
+    });
+
+    process::exit( 0 );
+
+}
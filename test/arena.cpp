@@ -0,0 +1,61 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/timer.h>
+#include <nodepp/json.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* whatever the library registers while an arena is active has to land on
+   the heap, since the loop runs it after the scope and its arena are gone */
+
+bool drain( const ptr_t<int>& fired ){ ulong tick = 0;
+    while( *fired == 0 && ++tick < 1000 ){ process::next(); }
+    return *fired != 0;
+}
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "timers armed inside a scope outlive it", [](){
+        ptr_t<int> fired = new int(0); ulong used = 0;
+        { arena_t a; arena_t::scope_t s(a); timer::timeout([=](){ (*fired)++; }, 10 ); used = a.size(); }
+        if( used != 0 || !drain( fired ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "tasks added inside a scope outlive it", [](){
+        ptr_t<int> fired = new int(0); ulong used = 0;
+        { arena_t a; arena_t::scope_t s(a); process::add([=](){ (*fired)++; return -1; }); used = a.size(); }
+        if( used != 0 || !drain( fired ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "listeners added inside a scope outlive it", [](){
+        event_t<> ev; ptr_t<int> fired = new int(0); ulong used = 0;
+        { arena_t a; arena_t::scope_t s(a); ev.on([=](){ (*fired)++; }); used = a.size(); }
+        ev.emit(); if( used != 0 || *fired != 1 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "an except_t thrown inside a scope outlives it", [](){
+        except_t error; { arena_t a; arena_t::scope_t s(a);
+            try { json::parse( "}" ); } catch( except_t& x ){ error = x; }
+        }   ptr_t<int> fired = new int(0); process::add([=](){ (*fired)++; return -1; });
+        if( !drain( fired ) || string_t( error.what() ) != "Invalid JSON Format" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "arena::heap escapes the active arena", [](){
+        arena_t a; arena_t::scope_t s(a); ptr_t<int> out;
+        arena::heap([&](){ out = new int(1); });
+        if( a.size() != 0 || arena::active() != &a ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
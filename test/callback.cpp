@@ -0,0 +1,68 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ count++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* builds, copies and calls function_t around captures on both sides of
+   FUNC_SBO, printing the time and the allocations each iteration took;
+   inline callables should show none at all */
+
+struct BIG { char data[ FUNC_SBO ] = { 0 }; };
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; ulong allocs = count;
+    process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x ); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, ":", wall / 1000, "ms,", string::to_string( double( count - allocs ) / n ),
+                  "allocs per call", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong n = 1000000; ptr_t<int> value = new int(3);
+    string_t text = "hello"; BIG big;
+
+    measure( "build + call, 8 byte capture   ", n, [&]( ulong x ){
+        function_t<ulong,ulong> f = [&]( ulong y ){ return y + n; }; return f( x );
+    });
+
+    measure( "build + call, ptr_t capture    ", n, [&]( ulong x ){
+        function_t<ulong,ulong> f = [=]( ulong y ){ return y + *value; }; return f( x );
+    });
+
+    measure( "copy + call, ptr_t capture     ", n, [&]( ulong x ){
+        function_t<ulong,ulong> f = [=]( ulong y ){ return y + *value; };
+        auto g = f; return g( x );
+    });
+
+    measure( "copy + call, string capture    ", n, [&]( ulong x ){
+        function_t<ulong,ulong> f = [=]( ulong y ){ return y + text.size(); };
+        auto g = f; return g( x );
+    });
+
+    measure( "copy + call, past FUNC_SBO     ", n, [&]( ulong x ){
+        function_t<ulong,ulong> f = [=]( ulong y ){ return y + big.data[0] + 1; };
+        auto g = f; return g( x );
+    });
+
+    event_t<ulong> ev; ulong sum = 0; ev.on([&]( ulong y ){ sum += y; });
+    measure( "event_t emit, one listener     ", n, [&]( ulong x ){ ev.emit( x ); return sum; });
+
+    process::exit( 0 );
+
+}
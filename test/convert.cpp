@@ -0,0 +1,62 @@
+#include <nodepp/nodepp.h>
+#include <cstdio>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* parses and formats 1M integers and doubles with the sscanf/snprintf
+   calls number.h replaced and with _number_, printing the time per
+   conversion and how many times faster _number_ was. Short doubles take
+   the exact fast path, 17 digit ones fall back to strtod on a copy, so
+   those are timed against strtod itself */
+
+template< class F >
+double measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x ); }
+    process::yield(); double out = double( process::micros() - stamp ) * 1000 / n;
+    console::log( name, ":", string::to_string( out ), "ns", sum == 0 ? "!" : "" ); return out;
+}
+
+void speedup( double before, double after ){
+    console::log( "   ", string::to_string( before / after ), "x faster" );
+}
+
+void onMain() {
+
+    ulong n = 1000000; const ulong M = 1024; char buf[ M ][ 32 ], num[ M ][ 32 ], big[ M ][ 32 ];
+    for( ulong x=0; x<M; x++ ){
+        snprintf( buf[x], 32, "%lld", (llong)( x * 2654435761ULL % 1000000007 ) - 500000000 );
+        snprintf( num[x], 32, "%.2f" , double( x ) * 1.37 + 0.125 );
+        snprintf( big[x], 32, "%.17g", double( x ) * 1.37 + 0.125 );
+    }
+
+    double a, b; char out[ 32 ];
+
+    a = measure( "sscanf   %lld   ", n, [&]( ulong x ){ llong v; sscanf( buf[ x % M ], "%lld", &v ); return (ulong) v; });
+    b = measure( "_number_ llong  ", n, [&]( ulong x ){ llong v; const char* e; auto s = buf[ x % M ];
+        _number_::parse( s, s + strlen( s ), v, e ); return (ulong) v;
+    }); speedup( a, b );
+
+    a = measure( "sscanf   %lf    ", n, [&]( ulong x ){ double v; sscanf( num[ x % M ], "%lf", &v ); return (ulong)( v + 1 ); });
+    b = measure( "_number_ double ", n, [&]( ulong x ){ double v; const char* e; auto s = num[ x % M ];
+        _number_::parse( s, s + strlen( s ), v, e ); return (ulong)( v + 1 );
+    }); speedup( a, b );
+
+    a = measure( "strtod   17 dig ", n, [&]( ulong x ){ return (ulong)( strtod( big[ x % M ], nullptr ) + 1 ); });
+    b = measure( "_number_ 17 dig ", n, [&]( ulong x ){ double v; const char* e; auto s = big[ x % M ];
+        _number_::parse( s, s + strlen( s ), v, e ); return (ulong)( v + 1 );
+    }); speedup( a, b );
+
+    a = measure( "snprintf %lld   ", n, [&]( ulong x ){ return (ulong) snprintf( out, 32, "%lld", (llong) x - 500000 ); });
+    b = measure( "_number_ llong  ", n, [&]( ulong x ){ return _number_::format( out, (llong) x - 500000 ); });
+    speedup( a, b );
+
+    a = measure( "snprintf %.17g  ", n, [&]( ulong x ){ return (ulong) snprintf( out, 32, "%.17g", double( x ) * 0.37 + 0.125 ); });
+    b = measure( "_number_ double ", n, [&]( ulong x ){ return _number_::format( out, double( x ) * 0.37 + 0.125 ); });
+    speedup( a, b );
+
+    process::exit( 0 );
+
+}
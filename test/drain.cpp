@@ -0,0 +1,33 @@
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* keeps 1k loop tasks alive until they have been dispatched 2M times,
+   once per budget, printing how long that took; a budget of one is the
+   old one-at-a-time scheduling, larger ones drain that many tasks per
+   pass of process::next() */
+
+void onMain() {
+
+    ulong size[] = { 1, 16, 256, 1024 }; ulong n = 2000000;
+
+    for( ulong budget : size ){
+
+        process::budget( budget ); ptr_t<ulong> count = new ulong(0);
+        for( ulong x=0; x<1000; x++ ){ process::loop::add([=](){
+            return ++(*count) >= n ? -1 : 1;
+        }); }
+
+        process::yield(); ulong stamp = process::micros(); ulong pass = 0;
+        while( !process::loop::empty() ){ process::next(); pass++; }
+        process::yield(); ulong wall = process::micros() - stamp;
+
+        console::log( "budget", budget, ":", wall / 1000, "ms,", *count, "dispatches in", pass, "passes" );
+
+    }
+
+    process::exit( 0 );
+
+}
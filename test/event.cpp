@@ -0,0 +1,54 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ count++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* churns queue nodes through listeners, microtasks and a bare queue,
+   printing the time and the allocations each operation took; nodes
+   come back from the QUEUE_POOL freelist, so what is left per operation
+   is the callback and its handle */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; ulong allocs = count;
+    process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x ); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, ":", string::to_string( wall * 1000.0 / n ), "ns,",
+                  string::to_string( double( count - allocs ) / n ), "allocs per op", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong n = 1000000; ulong sum = 0;
+
+    event_t<ulong> ev; measure( "event_t once + emit ", n, [&]( ulong x ){
+        ev.once([&]( ulong y ){ sum += y + 1; }); ev.emit( x ); return sum;
+    });
+
+    measure( "micro add + drain   ", n, [&]( ulong x ){
+        process::micro::add([&]( ulong y ){ sum += y + 1; }, x );
+        process::micro::drain(); return sum;
+    });
+
+    queue_t<ulong> queue; measure( "queue_t push + shift", n, [&]( ulong x ){
+        queue.push( x + 1 ); if( queue.size() > 16 ){ sum += queue.first()->data; queue.shift(); }
+        return sum;
+    });
+
+    process::exit( 0 );
+
+}
@@ -0,0 +1,37 @@
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* searches a 1 MB haystack whose only match sits at the very end, with
+   needles that start like the filler so most candidates get past the
+   first byte, then splits 2 MB of short lines; prints the time per call */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb(); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, ":", string::to_string( double( wall ) / n ), "us per call", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    string_t hay; hay.reserve( 1 << 20 );
+    while( hay.size() < ( 1 << 20 ) - 64 ){ hay += "abcabcabdabcEN"; }
+    hay += "Z"; hay += "END"; hay += "abcabcabdabcabcabcabdabcabcabcabdZ";
+
+    string_t text; text.reserve( 2 << 20 );
+    while( text.size() < ( 2 << 20 ) ){ text += "key=value; line\n"; }
+
+    measure( "find( 'Z' ),       1 MB", 100, [&](){ return (ulong) hay.find( 'Z' )[0]; });
+    measure( "find( \"END\" ),     1 MB", 100, [&](){ return (ulong) hay.find( "END" )[0]; });
+    measure( "find( 34 bytes ),  1 MB", 100, [&](){
+        return (ulong) hay.find( "abcabcabdabcabcabcabdabcabcabcabdZ" )[0];
+    });
+    measure( "split( '\\n' ),     2 MB", 10 , [&](){ return string::split( text, '\n' ).size(); });
+
+    process::exit( 0 );
+
+}
@@ -0,0 +1,58 @@
+#include <cstdlib>
+#include <new>
+
+/* counts every allocation, so a case can check which callables are
+   kept inline and which ones are shared on the heap */
+
+static unsigned long allocs = 0;
+
+void* operator new  ( std::size_t n ){ allocs++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ allocs++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+struct BIG { char data[ FUNC_SBO ] = { 0 }; };
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "small callables are copied without allocating", [](){
+        ptr_t<int> value = new int(3); ulong before = allocs;
+        function_t<int,int> a = [=]( int x ){ return x + *value; };
+        auto b = a; function_t<int,int> c; c = b;
+        if( allocs != before || c(1) != 4 || a.count() != 1 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "large callables are shared between copies", [](){
+        BIG big; function_t<int> a = [=](){ return (int) big.data[0] + FUNC_SBO; };
+        auto b = a; if( a.count() != 2 || b() != FUNC_SBO ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "free() on an inline callable only releases that copy", [](){
+        function_t<int> a = [](){ return 1; }; auto b = a; b.free();
+        if( b.has_value() || !a.has_value() || a() != 1 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "free() on a shared callable releases every copy", [](){
+        BIG big; function_t<int> a = [=](){ return (int) big.data[0] + FUNC_SBO; };
+        auto b = a; b.free(); if( a.has_value() || b.has_value() ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
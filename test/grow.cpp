@@ -0,0 +1,47 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void* operator new[]( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* builds a string one byte at a time up to 10 MB and an array one element
+   at a time up to 1M, printing the time and the allocations each build
+   took; with geometric growth both should stay linear in time and
+   logarithmic in allocations */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong allocs = count; process::yield(); ulong stamp = process::micros();
+    ulong size = cb( n ); process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, "x", n, ":", string::to_string( wall / 1000.0 ), "ms,", count - allocs, "allocs",
+                  size != n ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong text[] = { 10000, 100000, 10000000 };
+    ulong list[] = { 10000, 1000000 };
+
+    for( ulong n : text ){ measure( "string_t push", n, []( ulong n ){
+        string_t out; for( ulong x=0; x<n; x++ ){ out.push( (char)( 'a' + x % 26 ) ); } return out.size();
+    }); }
+
+    for( ulong n : list ){ measure( "array_t push ", n, []( ulong n ){
+        array_t<int> out; for( ulong x=0; x<n; x++ ){ out.push( (int) x ); } return out.size();
+    }); }
+
+    process::exit( 0 );
+
+}
@@ -0,0 +1,59 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void* operator new[]( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/json.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* parses the same small document N times and reads three fields back,
+   once on the global heap and once inside an arena reset per document;
+   what the arena run still allocates is what is built with a plain new */
+
+string_t doc = "{\"id\":42,\"name\":\"alice\",\"tags\":[\"a\",\"b\",\"c\"],"
+               "\"meta\":{\"ok\":true,\"score\":1.5},\"lang\":\"en\","
+               "\"items\":[{\"k\":1,\"v\":\"x\"},{\"k\":2,\"v\":\"y\"}]}";
+
+ulong touch(){
+    auto obj = json::parse( doc ); return obj["id"].as<int>()
+         + obj["name"].as<string_t>().size() + obj["items"][1]["v"].as<string_t>().size();
+}
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; ulong allocs = count;
+    process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb(); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, "x", n, ":", wall / 1000, "ms,", count - allocs, "allocs", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong size[] = { 1000, 10000 };
+
+    for( ulong n : size ){
+
+        measure( "heap ", n, [](){ return touch(); });
+
+        arena_t arena; measure( "arena", n, [&](){
+            ulong out; { arena_t::scope_t scope( arena ); out = touch(); }
+            arena.reset(); return out;
+        });
+
+    }
+
+    process::exit( 0 );
+
+}
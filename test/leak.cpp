@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <new>
+
+/* tracks how many allocations are alive, so a case can check that
+   creating and dropping objects leaves the heap where it found it */
+
+static long live = 0;
+
+void* operator new  ( std::size_t n ){ live++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ live++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { if( p ){ live--; } free( p ); }
+void  operator delete[]( void* p ) noexcept { if( p ){ live--; } free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { if( p ){ live--; } free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { if( p ){ live--; } free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/promise.h>
+#include <nodepp/test.h>
+
+#if _KERNEL == NODEPP_KERNEL_WASM
+#include <nodepp/ws.h>
+#endif
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* runs 10k create/drop cycles three times and returns how many more
+   allocations are alive after the last round than after the first,
+   the first round warms up pools and free lists. Queues with a cap stop
+   growing once full, so the cases also check nothing was left queued */
+
+#define GROWTH( ... ) [](){ long base = 0;                                    \
+    for( int round=0; round<3; round++ ){                                   \
+        for( int x=0; x<10000; x++ ){ __VA_ARGS__ }                         \
+        int tick = 0; do { process::next(); }                               \
+        while( !process::poll::empty() && ++tick < 20000 );                 \
+        if( round == 0 ){ base = live; }                                    \
+    }   return live - base;                                                 \
+}()
+
+bool settled() {
+    return process::onSIGERR.size() < 128 && process::poll::empty();
+}
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "except_t releases its signal listener", [](){
+        if( GROWTH( except_t err( "boom" ); ) > 0 || !settled() ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "test_t releases its signal listener", [](){
+        if( GROWTH( test_t item; TEST_ADD( item, "x", [](){ TEST_DONE(); } ); ) > 0 || !settled() ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "promise_t does not keep itself alive", [](){
+        if( GROWTH( promise_t<int,except_t> item([]( function_t<void,int> res, function_t<void,except_t> ){ res(1); });
+                    item.then([]( int ){}); ) > 0 || !settled() ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "queue_t keeps at most QUEUE_POOL freed nodes", [](){
+        struct ITEM { int x; }; long base = live;
+        { queue_t<ITEM> item; for( int x=0; x<QUEUE_POOL*4; x++ ){ item.push({ x }); } }
+        if( live - base > QUEUE_POOL ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+#if _KERNEL == NODEPP_KERNEL_WASM
+    TEST_ADD( test, "ws_t dies with its last handle", [](){
+        if( GROWTH( ws_t item( "ws://localhost" ); item.onData([]( string_t ){}); ) > 0 || !settled() ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+#endif
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
@@ -0,0 +1,41 @@
+#include <nodepp/nodepp.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* fills a map with N string keys, then looks every one of them up and as
+   many keys that are not there, printing the time each lookup took; with
+   the open addressed index the cost should only grow with cache misses,
+   not with the number of keys */
+
+template< class F >
+void measure( const char* name, ulong size, ulong n, F cb ){
+    ulong sum = 0; process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x % size ); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, "x", size, ":", string::to_string( wall * 1000.0 / n ), "ns per lookup",
+                  sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong size[] = { 10, 100, 1000, 10000, 100000, 1000000 };
+
+    for( ulong n : size ){
+
+        map_t<string_t,ulong> map; array_t<string_t> hit, miss;
+        for( ulong x=0; x<n; x++ ){
+            hit .push( string::format( "key-%lu", x ) );
+            miss.push( string::format( "nil-%lu", x ) );
+            map[ hit[x] ] = x + 1;
+        }
+
+        measure( "hit ", n, 1000000, [&]( ulong x ){ return map[ hit[x] ]; });
+        measure( "miss", n, 1000000, [&]( ulong x ){ return map.has( miss[x] ) ? 0UL : 1UL; });
+
+    }
+
+    process::exit( 0 );
+
+}
@@ -0,0 +1,42 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "integer tokens longer than the stack copy", [](){
+        string_t num ( 150UL, '7' );
+        if( string::to_double( num ) != strtod( num.get(), nullptr ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "fraction tokens longer than the stack copy", [](){
+        string_t num = "0." + string_t( 140UL, '0' ) + "123";
+        if( string::to_double( num ) != strtod( num.get(), nullptr ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "slow path stops at the end of the token", [](){
+        double out = 0; string_t num = "1e400,2";
+        if( string::to_number( num, out ) != ERANGE ){ TEST_FAIL(); }
+        if( string::to_double( "123456789012345678901234567890,1" ) != 123456789012345678901234567890. )
+          { TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "fast path round trips", [](){
+        if( string::to_double( "0.1" ) != 0.1 ){ TEST_FAIL(); }
+        if( string::to_double( "-2.5e-3" ) != -2.5e-3 ){ TEST_FAIL(); }
+        if( string::to_string( 0.1 ) != "0.1" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
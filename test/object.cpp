@@ -0,0 +1,35 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/json.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "a reference from a missing key survives size()", [](){
+        object_t obj = json::parse( "{\"a\":1}" ); auto& ref = obj["b"];
+        if( obj.size() != 2 || obj.empty() ){ TEST_FAIL(); } ref = 2;
+        if( !obj.has( "b" ) || obj["b"].as<int>() != 2 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "keys, copy and stringify skip keys never assigned", [](){
+        object_t obj = json::parse( "{\"a\":1}" ); obj["b"]; obj["c"];
+        auto out = obj.copy(); if( obj.keys().size() != 1 || out.size() != 1 ){ TEST_FAIL(); }
+        if( json::stringify( obj ) != "{\"a\":1}" || obj.has( "b" ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "has() leaves a plain value alone", [](){
+        object_t obj = 10; if( obj.has( "a" ) || obj.as<int>() != 10 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
@@ -0,0 +1,52 @@
+#include <cstdlib>
+#include <new>
+
+static unsigned long count = 0;
+
+void* operator new  ( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void* operator new[]( std::size_t n ){ count++; if( void* p = malloc( n ) ){ return p; } throw std::bad_alloc(); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/promise.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* settles a chain of 100k promises, each one started from the then() of
+   the one before, first on an idle loop and then next to 100 loop tasks
+   that never finish, printing the time and the allocations per promise;
+   the chain settles through microtasks, so the busy loop should barely
+   slow it down */
+
+void chain( ptr_t<ulong> left ){
+    promise_t<ulong,except_t>([=]( function_t<void,ulong> res, function_t<void,except_t> ){ res( *left ); })
+   .then([=]( ulong ){ if( --(*left) > 0 ){ chain( left ); } });
+}
+
+void measure( const char* name, ulong n ){
+    ptr_t<ulong> left = new ulong( n ); ulong allocs = count;
+    process::yield(); ulong stamp = process::micros();
+    chain( left ); while( *left > 0 ){ process::next(); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, "x", n, ":", wall / 1000, "ms,",
+                  string::to_string( double( count - allocs ) / n ), "allocs per promise" );
+}
+
+void onMain() {
+
+    ulong n = 100000;
+
+    measure( "idle loop       ", n );
+
+    ptr_t<bool> busy = new bool(1);
+    for( int x=0; x<100; x++ ){ process::loop::add([=](){ return *busy ? 1 : -1; }); }
+    measure( "100 busy tasks  ", n ); *busy = 0;
+
+    process::exit( 0 );
+
+}
@@ -0,0 +1,52 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/worker.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+struct OBJ { static int live; int value = 7;
+     OBJ() noexcept { __atomic_add_fetch( &live, 1, __ATOMIC_RELAXED ); }
+    ~OBJ() noexcept { __atomic_sub_fetch( &live, 1, __ATOMIC_RELAXED ); }
+};  int OBJ::live = 0;
+
+void join() { while( __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) > 0 ){ process::next(); } }
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "copies from many threads keep one count", [](){
+        for( int round=0; round<10; round++ ){
+            auto item = atomic_ptr_t<OBJ>::make(); atomic_ptr_t<int> bad = new int(0);
+            for( int x=0; x<8; x++ ){ worker::add([=](){
+                for( int y=0; y<100000; y++ ){ atomic_ptr_t<OBJ> a = item, b = a;
+                    if( b->value != 7 ){ __atomic_store_n( &*bad, 1, __ATOMIC_RELAXED ); }
+                }   return -1;
+            }); }
+            join(); if( *bad || item.count() != 1 ){ TEST_FAIL(); }
+            item.reset(); if( OBJ::live != 0 ){ TEST_FAIL(); }
+        }   TEST_DONE();
+    });
+
+    TEST_ADD( test, "weak locks race the last owner", [](){
+        for( int round=0; round<10; round++ ){
+            auto item = atomic_ptr_t<OBJ>::make(); weak_ptr_t<OBJ,true> weak = item;
+            atomic_ptr_t<int> bad = new int(0);
+            for( int x=0; x<8; x++ ){ worker::add([=](){
+                for( int y=0; y<100000; y++ ){ auto a = weak.lock();
+                    if( !a.null() && a->value != 7 ){ __atomic_store_n( &*bad, 1, __ATOMIC_RELAXED ); }
+                }   return -1;
+            }); }
+            item.reset(); join();
+            if( *bad || !weak.expired() || OBJ::live != 0 ){ TEST_FAIL(); }
+        }   TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
@@ -0,0 +1,43 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/worker.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* copies and drops a ptr_t and an atomic_ptr_t 5M times on one thread,
+   then the atomic one from four workers at once, printing the time per
+   copy; the first pair is what the atomic policy costs when there is no
+   contention, the last line what sharing the count across cores costs */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb(); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, ":", string::to_string( wall * 1000.0 / n ), "ns per copy", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong n = 5000000; auto plain = ptr_t<int>::make( 1 ); auto shared = atomic_ptr_t<int>::make( 1 );
+
+    measure( "ptr_t,        one thread ", n, [&](){ ptr_t<int> c = plain; return c.count(); });
+    measure( "atomic_ptr_t, one thread ", n, [&](){ atomic_ptr_t<int> c = shared; return c.count(); });
+
+    process::yield(); ulong stamp = process::micros();
+
+    for( int x=0; x<4; x++ ){ worker::add([=](){
+        for( ulong y=0; y<n / 4; y++ ){ atomic_ptr_t<int> c = shared; if( *c != 1 ){ break; } }
+        return -1;
+    }); }
+
+    while( __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) > 0 ){ process::next(); }
+
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( "atomic_ptr_t, four workers:", string::to_string( wall * 1000.0 / n ), "ns per copy,",
+                  "count back to", shared.count() );
+
+    process::exit( 0 );
+
+}
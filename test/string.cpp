@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <new>
+
+/* counts every allocation, so a case can check that copying short
+   strings and parsing small documents stay off the heap where they can */
+
+static unsigned long allocs = 0;
+
+void* operator new  ( std::size_t n ){ allocs++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ allocs++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/query.h>
+#include <nodepp/json.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "short copies are independent values", [](){
+        string_t a = "hello"; string_t b = a; b[0] = 'X';
+        if( a != "hello" || b != "Xello" ){ TEST_FAIL(); }
+        string_t c = "abc"; string_t d; d = c; d.fill( 'Z' );
+        if( c != "abc" || d != "ZZZ" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "copying a short string never allocates", [](){
+        const string_t a = "hello"; ulong before = allocs;
+        string_t b = a; string_t c; c = b; string_t d = a;
+        if( allocs != before || c != "hello" || d != "hello" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "long copies share their bytes", [](){
+        string_t a = "a string well past the inline threshold";
+        string_t b = a; b[0] = 'X'; if( a[0] != 'X' ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "replace is seen through every long copy", [](){
+        string_t a = "a string well past the inline threshold"; auto b = a;
+        b.replace( [=]( char c ){ return c == 'a'; }, 'Z' );
+        if( a[0] != 'Z' ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "ptr() keeps a shared buffer shared", [](){
+        string_t a = "a string well past the inline threshold"; a.reserve( 128 );
+        string_t b = a; b.ptr()[0] = 'X'; if( a[0] != 'X' ){ TEST_FAIL(); }
+        string_t c = "short"; auto& p = c.ptr(); p[0] = 'X'; if( c != "Xhort" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "growing a copy detaches it", [](){
+        string_t a = "abc"; string_t b = a; b.push( 'd' );
+        if( a != "abc" || b != "abcd" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "copy() is independent", [](){
+        string_t a = "abc"; auto b = a.copy(); b[0] = 'Z';
+        if( a != "abc" || b != "Zbc" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "views never allocate", [](){
+        string_t a = "a string well past the inline threshold"; string_t b = "short";
+        ulong before = allocs; string_view_t x( a ), y( b ), z( "a literal past the inline threshold" );
+        auto w = x.slice( 2, 8 ); auto v = string_view_t( w, 1, 3 ); auto u = y.slice( 1 );
+        if( allocs != before || w != "string" || v != "tri" || u != "hort" || z.size() != 35 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "splitting into views allocates nothing per token", [](){
+        string_t a; for( ulong x=0; x<512; x++ ){ a += "key=value&"; }
+        ulong before = allocs; auto list = string::split( string_view_t( a ), '&' );
+        ulong used = allocs - before, sum = 0; before = allocs;
+        for( auto& x : list ){ sum += x.find( '=' ) + x.slice( 4 ).size(); }
+        if( list.size() != 512 || sum != 512 * 8 || used > 16 || allocs != before ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "query and json parsing keep their allocation count", [](){
+        string_t q = "?name=john&age=30&city=paris&lang=en&page=2&sort=asc&tag=x";
+        string_t j = "{\"a\":1,\"b\":\"two\",\"c\":[1,2,3],\"d\":{\"e\":true,\"f\":null}}";
+        ulong before = allocs; auto x = query::parse( q ); ulong a = allocs - before;
+              before = allocs; auto y = json::parse( j );  ulong b = allocs - before;
+        if( a > 14 || b > 64 || x["city"] != "paris" || y["b"].as<string_t>() != "two" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "format_to writes in place and grows once when out of room", [](){
+        string_t out; out.reserve( 4096 ); ulong before = allocs;
+        for( ulong x=0; x<100; x++ ){ string::format_to( out, "%lu,", x ); }
+        if( allocs != before || out.size() != 290 || out.slice( 0, 6 ) != "0,1,2," ){ TEST_FAIL(); }
+        string_t big( 10000, 'x' ); before = allocs; string::format_to( out, "[%s]", big.get() );
+        if( allocs - before != 1 || out.size() != 10292 || out[ out.size() - 1 ] != ']' ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "format_to copes with arguments taken from out", [](){
+        string_t out( 100, 'a' ); string_t copy = out;
+        string::format_to( out, "%s%s", out.get(), out.get() );
+        string::format_to( copy, copy, 1 );
+        if( out.size() != 300 || out != string_t( 300, 'a' ) || copy != string_t( 200, 'a' ) ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
@@ -0,0 +1,81 @@
+#include <cstdlib>
+#include <new>
+
+/* counts every allocation, so a case can check that a warmed up queue
+   spawns and retires tasks without touching the heap */
+
+static unsigned long allocs = 0;
+
+void* operator new  ( std::size_t n ){ allocs++; return malloc( n ); }
+void* operator new[]( std::size_t n ){ allocs++; return malloc( n ); }
+void  operator delete  ( void* p ) noexcept { free( p ); }
+void  operator delete[]( void* p ) noexcept { free( p ); }
+void  operator delete  ( void* p, std::size_t ) noexcept { free( p ); }
+void  operator delete[]( void* p, std::size_t ) noexcept { free( p ); }
+
+#include <nodepp/nodepp.h>
+#include <nodepp/promise.h>
+#include <nodepp/test.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* spawns and retires 100 tasks on one queue twice, returning how many
+   allocations the second round took; the first one warms the free
+   lists up, callbacks are pooled per type so both share one lambda */
+
+#define CYCLE( QUEUE ) [](){ unsigned long out = 0;                           \
+    ptr_t<int> count = new int(0); for( int y=0; y<2; y++ ){                \
+    unsigned long before = allocs;                                          \
+    for( int x=0; x<100; x++ ){ QUEUE::add([=](){ (*count)++; return -1; }); } \
+    while( !QUEUE::empty() ){ QUEUE::next(); } out = allocs - before;       \
+    }   return out;                                                         \
+}()
+
+void onMain() {
+
+    auto test = TEST_CREATE(); int fail = 0;
+    test.onFail([&](){ fail++; });
+
+    TEST_ADD( test, "loop tasks are recycled once warmed up", [](){
+        if( CYCLE( process::loop ) != 0 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "poll tasks are recycled once warmed up", [](){
+        if( CYCLE( process::poll ) != 0 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "coroutine tasks are recycled once warmed up", [](){
+        if( CYCLE( process::task ) != 0 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "a busy loop still hands the host a turn", [](){
+        ptr_t<bool> busy = new bool(1); process::add([=](){ return *busy ? 1 : -1; });
+        process::yield(); ulong stamp = process::micros(), last = process::_spin_, turns = 0;
+        while( process::micros() - stamp < HOST_YIELD * 5000UL ){ process::next();
+            if( process::_spin_ != last ){ last = process::_spin_; turns++; }
+        }   *busy = 0; process::next();
+        if( turns < 3 ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_ADD( test, "microtasks drain before the next macrotask", [](){
+        ptr_t<string_t> order = new string_t();
+        process::loop::add([=](){ *order += "a";
+            process::micro::add([=](){ *order += "m"; process::micro::add([=](){ *order += "n"; }); });
+            promise_t<int,except_t>([]( function_t<void,int> res, function_t<void,except_t> ){ res(1); })
+           .then([=]( int ){ *order += "p"; }); return -1;
+        });
+        process::loop::add([=](){ *order += "b"; return -1; });
+        while( !process::loop::empty() ){ process::next(); }
+        if( *order != "amnpb" ){ TEST_FAIL(); }
+        TEST_DONE();
+    });
+
+    TEST_AWAIT( test ); process::exit( fail );
+
+}
@@ -0,0 +1,40 @@
+#include <nodepp/nodepp.h>
+#include <nodepp/timer.h>
+#include <ctime>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* arms N intervals that never come due, plus a 1ms probe interval, then
+   runs the loop for half a second. How often the probe fires shows how
+   long one pass over the pending timers takes, and the cpu figure is how
+   much of each wall millisecond the loop spent working, not sleeping */
+
+void onMain() {
+
+    ulong size[] = { 10, 100, 1000, 10000, 100000 };
+
+    for( ulong n : size ){
+
+        queue_t<handle_t> list; ptr_t<ulong> fired = new ulong(0);
+        for( ulong x=0; x<n; x++ ){ list.push( timer::interval( [](){}, 600000UL ) ); }
+        list.push( timer::interval( [=](){ (*fired)++; }, 1UL ) );
+
+        process::yield(); ulong stamp = process::micros(); clock_t cpu = clock();
+        while( process::micros() - stamp < 500000UL ){ process::next(); }
+        double wall = double( process::micros() - stamp ) / 1000;
+        double used = double( clock() - cpu ) * 1000 / CLOCKS_PER_SEC;
+
+        console::log( n, "timers:", "probe fired", *fired, "times in",
+            string::to_string( (ulong) wall ), "ms, cpu",
+            string::to_string( (ulong)( used * 1000 / wall ) ), "us per ms"
+        );
+
+        list.map([]( handle_t& x ){ timer::clear( x ); });
+
+    }
+
+    process::exit( 0 );
+
+}
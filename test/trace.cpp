@@ -0,0 +1,55 @@
+#define NODEPP_TRACE 1
+
+#include <nodepp/nodepp.h>
+#include <nodepp/worker.h>
+#include <nodepp/json.h>
+
+using namespace nodepp;
+
+/*────────────────────────────────────────────────────────────────────────────*/
+
+/* times a span and a begin/end pair on one thread, then has four workers
+   push spans while the main thread keeps flushing, printing the time per
+   span and how many events made it out; every flush has to parse, so a
+   torn event would show up as a parse error */
+
+template< class F >
+void measure( const char* name, ulong n, F cb ){
+    ulong sum = 0; process::yield(); ulong stamp = process::micros();
+    for( ulong x=0; x<n; x++ ){ sum += cb( x ); }
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( name, ":", string::to_string( wall * 1000.0 / n ), "ns per op", sum == 0 ? "!" : "" );
+}
+
+void onMain() {
+
+    ulong n = 1000000;
+
+    measure( "span_t, one thread    ", n, []( ulong x ){
+        _trace_::span_t span( "bench", "span" ); return x + 1;
+    });
+
+    measure( "begin + end, one thread", n, []( ulong x ){
+        _trace_::end( "bench", "pair", _trace_::begin( "bench", "pair" ) ); return x + 1;
+    });
+
+    process::trace::clear(); ulong events = 0;
+    process::yield(); ulong stamp = process::micros();
+
+    for( int x=0; x<4; x++ ){ worker::add([=](){
+        for( ulong y=0; y<n / 4; y++ ){ _trace_::span_t span( "bench", "worker" ); }
+        return -1;
+    }); }
+
+    while( __atomic_load_n( &process::threads, __ATOMIC_ACQUIRE ) > 0 || process::trace::size() > 0 ){
+        auto out = json::parse( process::trace::flush() );
+        events += out["traceEvents"].as<array_t<object_t>>().size();
+    }
+
+    process::yield(); ulong wall = process::micros() - stamp;
+    console::log( "span_t, four workers   :", string::to_string( wall * 1000.0 / n ), "ns per op,",
+                  events, "of", n * 2, "events flushed" );
+
+    process::exit( 0 );
+
+}